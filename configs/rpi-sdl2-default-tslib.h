@@ -179,6 +179,16 @@ extern "C" {
 
   // Enable hardware acceleration
   #define DRV_SDL_RENDER_ACCEL 1
+
+  // Text texture cache
+  // - Number of rendered text strings retained as textures (0 to disable)
+  // - Maximum texture memory (bytes) used by the cache
+  #define DRV_SDL_TXT_CACHE_MAX 64
+  #define DRV_SDL_TXT_CACHE_MEM (2*1024*1024)
+
+  // Glyph atlas text rendering (1 to enable, 0 to disable)
+  // - Draws ASCII strings by composing glyphs rendered once per font
+  #define DRV_SDL_TXT_ATLAS_EN  0
   
   
   #define GSLC_USE_PROGMEM      0
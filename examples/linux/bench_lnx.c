@@ -0,0 +1,267 @@
+//
+// GUIslice Library Examples
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Rendering benchmark (LINUX, MEMFB driver):
+//     Runs a scripted version of an example for a fixed number of
+//     updates and reports the update rate, the time spent per
+//     gslc_Update() call, the driver primitive call counts and the
+//     number of pixels written.
+// - Optionally, the framebuffer is flushed to an emulated panel on
+//   each page flip (see gslc_DrvSetFlushCb()) and the number of
+//   changed pixels that would be sent over the panel bus is reported.
+//
+// - The example is compiled into this file (see "make bench"):
+//     BENCH_EX_FILE:  source file of the example
+//     BENCH_EX_NAME:  name used to select the touch script
+// - Usage: bench_<example> [num_updates] [flush]
+//
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if !defined(DRV_DISP_MEMFB)
+  #error "bench_lnx requires the MEMFB driver (make bench)"
+#endif
+
+#if !defined(BENCH_EX_FILE) || !defined(BENCH_EX_NAME)
+  #error "bench_lnx requires BENCH_EX_FILE and BENCH_EX_NAME"
+#endif
+
+#define BENCH_FRAMES_DEF  1000    // Default number of updates
+
+
+// ------------------------------------------------
+// Touch scripts
+// ------------------------------------------------
+
+// A scripted gesture: press at (nX0,nY0), drag to (nX1,nY1)
+// over nFrames updates and release. A tap uses the same start
+// and end coordinates. Each gesture is followed by nIdle updates
+// without touch input.
+typedef struct {
+  int16_t   nX0;
+  int16_t   nY0;
+  int16_t   nX1;
+  int16_t   nY1;
+  uint16_t  nFrames;
+  uint16_t  nIdle;
+} bench_tsGesture;
+
+typedef struct {
+  const char*             pName;
+  const bench_tsGesture*  asGesture;
+  uint16_t                nNumGesture;
+} bench_tsScript;
+
+// ex04: drag the slider, toggle the checkboxes
+static const bench_tsGesture m_asScriptEx04[] = {
+  { 165,150, 255,150, 40, 5 },
+  { 255,150, 165,150, 40, 5 },
+  {  90,110,  90,110,  2, 5 },
+  {  90,145,  90,145,  2, 5 },
+};
+
+// ex08: press each of the control buttons
+static const bench_tsGesture m_asScriptEx08[] = {
+  {  37,160,  37,160,  4, 4 },
+  {  98,160,  98,160,  4, 4 },
+  { 159,160, 159,160,  4, 4 },
+  {  37,190,  37,190,  4, 4 },
+  {  98,190,  98,190,  4, 4 },
+};
+
+// ex11: drag the slider that drives the graph
+static const bench_tsGesture m_asScriptEx11[] = {
+  {  25, 70, 155, 70, 60, 10 },
+  { 155, 70,  25, 70, 60, 10 },
+};
+
+// ex31: select list items, drag the scrollbar
+static const bench_tsGesture m_asScriptEx31[] = {
+  {  60, 90,  60, 90,  2, 5 },
+  {  60,130,  60,130,  2, 5 },
+  { 205, 85, 205,170, 40, 5 },
+  {  60,110,  60,110,  2, 5 },
+  { 205,170, 205, 85, 40, 5 },
+};
+
+// ex42: drag the slider that drives the ring gauge
+static const bench_tsGesture m_asScriptEx42[] = {
+  { 205, 90, 295, 90, 50, 5 },
+  { 295, 90, 205, 90, 50, 5 },
+};
+
+#define BENCH_SCRIPT(name,arr) { name, arr, sizeof(arr)/sizeof(arr[0]) }
+
+static const bench_tsScript m_asScript[] = {
+  BENCH_SCRIPT("ex04_lnx_ctrls",   m_asScriptEx04),
+  BENCH_SCRIPT("ex08_lnx_tuner",   m_asScriptEx08),
+  BENCH_SCRIPT("ex11_lnx_graph",   m_asScriptEx11),
+  BENCH_SCRIPT("ex31_lnx_listbox", m_asScriptEx31),
+  BENCH_SCRIPT("ex42_lnx_ring",    m_asScriptEx42),
+};
+
+
+// ------------------------------------------------
+// Benchmark state
+// ------------------------------------------------
+static const bench_tsScript*  m_pBenchScript  = NULL;
+static uint16_t               m_nBenchGesture = 0;
+static uint16_t               m_nBenchStep    = 0;
+static uint32_t               m_nBenchFrames  = BENCH_FRAMES_DEF;
+static uint32_t               m_nBenchUpdates = 0;
+static double                 m_dBenchTotalUs = 0;
+static double                 m_dBenchMinUs   = 0;
+static double                 m_dBenchMaxUs   = 0;
+static bool                   m_bBenchFlush   = false;
+
+static double bench_GetTimeUs()
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (double)sTime.tv_sec * 1e6 + (double)sTime.tv_nsec / 1e3;
+}
+
+// Inject the touch event for the current step of the script
+static void bench_ScriptStep(gslc_tsGui* pGui)
+{
+  if ((m_pBenchScript == NULL) || (m_pBenchScript->nNumGesture == 0)) {
+    return;
+  }
+  const bench_tsGesture* pGesture = &m_pBenchScript->asGesture[m_nBenchGesture];
+  uint16_t nStep = m_nBenchStep;
+
+  if (nStep < pGesture->nFrames) {
+    // Press / drag
+    int16_t nX = pGesture->nX0 + (int32_t)(pGesture->nX1 - pGesture->nX0) * nStep / pGesture->nFrames;
+    int16_t nY = pGesture->nY0 + (int32_t)(pGesture->nY1 - pGesture->nY0) * nStep / pGesture->nFrames;
+    gslc_DrvInjectTouch(pGui,nX,nY,1);
+  } else if (nStep == pGesture->nFrames) {
+    // Release
+    gslc_DrvInjectTouch(pGui,pGesture->nX1,pGesture->nY1,0);
+  }
+
+  // Advance to the next step, wrapping around the script
+  m_nBenchStep++;
+  if (m_nBenchStep > pGesture->nFrames + pGesture->nIdle) {
+    m_nBenchStep = 0;
+    m_nBenchGesture = (m_nBenchGesture + 1) % m_pBenchScript->nNumGesture;
+  }
+}
+
+// Emulated panel for gslc_DrvSetFlushCb()
+// - The pixels are only counted by the driver statistics
+static void bench_Flush(void* pvGui,gslc_tsRect rRect,const uint8_t* pPixels,uint32_t nStride)
+{
+  (void)pvGui;    // Unused
+  (void)rRect;    // Unused
+  (void)pPixels;  // Unused
+  (void)nStride;  // Unused
+}
+
+static void bench_Report(gslc_tsGui* pGui)
+{
+  gslc_tsDrvStats sStats;
+  gslc_DrvGetStats(pGui,&sStats);
+
+  double dTotalS  = m_dBenchTotalUs / 1e6;
+  double dAvgUs   = (m_nBenchUpdates > 0)? m_dBenchTotalUs / m_nBenchUpdates : 0;
+  double dRate    = (dTotalS > 0)? m_nBenchUpdates / dTotalS : 0;
+  double dPixPer  = (m_nBenchUpdates > 0)? (double)sStats.nPixels / m_nBenchUpdates : 0;
+
+  printf("BENCH %s\n",BENCH_EX_NAME);
+  printf("  Updates:      %u in %.3f ms (%.1f updates/s)\n",m_nBenchUpdates,m_dBenchTotalUs / 1e3,dRate);
+  printf("  Update time:  avg %.1f us, min %.1f us, max %.1f us\n",dAvgUs,m_dBenchMinUs,m_dBenchMaxUs);
+  printf("  Redraws:      %u\n",sStats.nCntFlip);
+  printf("  Draw calls:   point=%u points=%u line=%u lines=%u frame_rect=%u fill_rect=%u spans=%u txt=%u image=%u bkgnd=%u\n",
+    sStats.nCntPoint,sStats.nCntPoints,sStats.nCntLine,sStats.nCntLines,sStats.nCntFrameRect,
+    sStats.nCntFillRect,sStats.nCntSpans,sStats.nCntTxt,sStats.nCntImage,sStats.nCntBkgnd);
+  printf("  Pixels:       %llu (%.1f per update)\n",(unsigned long long)sStats.nPixels,dPixPer);
+  if (m_bBenchFlush) {
+    double dFlushPer = (m_nBenchUpdates > 0)? (double)sStats.nFlushPixels / m_nBenchUpdates : 0;
+    printf("  Flushed:      %llu (%.1f per update) in %u rects\n",(unsigned long long)sStats.nFlushPixels,
+      dFlushPer,sStats.nCntFlushRect);
+  }
+}
+
+// Replaces gslc_Update() within the example
+static void bench_Update(gslc_tsGui* pGui)
+{
+  if (m_nBenchUpdates == 0) {
+    if (m_bBenchFlush) {
+      gslc_DrvSetFlushCb(pGui,&bench_Flush,NULL);
+    }
+    gslc_DrvResetStats(pGui);
+  }
+  bench_ScriptStep(pGui);
+
+  double dStart = bench_GetTimeUs();
+  gslc_Update(pGui);
+  double dElapsed = bench_GetTimeUs() - dStart;
+
+  if ((m_nBenchUpdates == 0) || (dElapsed < m_dBenchMinUs)) { m_dBenchMinUs = dElapsed; }
+  if ((m_nBenchUpdates == 0) || (dElapsed > m_dBenchMaxUs)) { m_dBenchMaxUs = dElapsed; }
+  m_dBenchTotalUs += dElapsed;
+  m_nBenchUpdates++;
+
+  if (m_nBenchUpdates >= m_nBenchFrames) {
+    bench_Report(pGui);
+    gslc_Quit(pGui);
+    exit(0);
+  }
+}
+
+// Replaces usleep() within the example so that idle delays
+// in the main loop do not affect the measurement
+// - Not all of the examples sleep, so it may be unused
+static int __attribute__((unused)) bench_Sleep(useconds_t nUsec)
+{
+  (void)nUsec; // Unused
+  return 0;
+}
+
+
+// ------------------------------------------------
+// Example under test
+// ------------------------------------------------
+#define main        bench_ExMain
+#define gslc_Update bench_Update
+#define usleep      bench_Sleep
+
+#include BENCH_EX_FILE
+
+#undef main
+#undef gslc_Update
+#undef usleep
+
+
+int main( int argc, char* args[] )
+{
+  if (argc > 1) {
+    m_nBenchFrames = (uint32_t)strtoul(args[1],NULL,10);
+    if (m_nBenchFrames == 0) {
+      fprintf(stderr,"ERROR: invalid number of updates [%s]\n",args[1]);
+      return 1;
+    }
+  }
+  if (argc > 2) {
+    m_bBenchFlush = (strtoul(args[2],NULL,10) != 0);
+  }
+
+  for (unsigned nInd = 0; nInd < sizeof(m_asScript)/sizeof(m_asScript[0]); nInd++) {
+    if (strcmp(m_asScript[nInd].pName,BENCH_EX_NAME) == 0) {
+      m_pBenchScript = &m_asScript[nInd];
+    }
+  }
+  if (m_pBenchScript == NULL) {
+    fprintf(stderr,"WARNING: no touch script for %s\n",BENCH_EX_NAME);
+  }
+
+  return bench_ExMain(1,args);
+}
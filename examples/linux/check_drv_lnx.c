@@ -0,0 +1,435 @@
+//
+// GUIslice Library Examples
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Host check of the Arduino display drivers (LINUX, mock display):
+//     Builds the Adafruit-GFX or TFT_eSPI driver against a mock of
+//     its display library (mock/) that counts bus transactions and
+//     address windows and aborts if the transaction rules of the
+//     real library are broken. Each check reports the bus activity
+//     and compares the pixels written with a reference.
+// - The redraw check draws a page that uses each kind of primitive
+//   (including text, circles, triangles, rounded rects, bitmaps and
+//   a BMP image loaded from the "SD card") through gslc_Update(),
+//   which holds a single transaction across the redraw, and compares
+//   it with each element drawn on its own. Drivers that can read
+//   the display also redraw a cached element and show a popup with
+//   save-under, which read the display during the redraw.
+// - Drivers with sprites also read and write a region of a sprite.
+//
+// - Build and run with "make check"
+//
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include "elem/XProgress.h"
+
+#include "mock_disp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(DRV_DISP_ADAGFX) && !defined(DRV_DISP_TFT_ESPI)
+  #error "check_drv_lnx requires the Adafruit-GFX or TFT_eSPI driver (make check)"
+#endif
+
+#define MAX_PAGE    2
+#define MAX_FONT    1
+#define MAX_PT      400
+#define MAX_ELEM    12
+#define MAX_ELEM_POPUP 1
+
+#define BMP_FNAME   "check_drv.bmp"  // 24-bit BMP written for the SD card check
+#define BMP_W       40
+#define BMP_H       20
+
+gslc_tsGui      m_gui;
+gslc_tsDriver   m_drv;
+gslc_tsPage     m_asPage[MAX_PAGE];
+gslc_tsFont     m_asFont[MAX_FONT];
+gslc_tsElem     m_asElem[MAX_ELEM];
+gslc_tsElemRef  m_asElemRef[MAX_ELEM];
+gslc_tsElem     m_asElemPopup[MAX_ELEM_POPUP];
+gslc_tsElemRef  m_asElemRefPopup[MAX_ELEM_POPUP];
+
+gslc_tsXProgress  m_sXProgress;
+
+// 16-bit color image (BMP24 format in memory): height, width, pixels
+static const uint16_t m_anImgColor[2+8*8] = {
+  8,8,
+  0xF800,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x07E0,
+  0xF800,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x07E0,
+  0xF800,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x07E0,
+  0xF800,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x07E0,
+  0x001F,0x001F,0x001F,0x001F,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0x001F,0x001F,0x001F,0x001F,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0x001F,0x001F,0x001F,0x001F,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0x001F,0x001F,0x001F,0x001F,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+};
+
+// Monochrome image (RAW1 format): width, height, color, bits
+static const unsigned char m_acImgMono[7+2*8] = {
+  0,16, 0,8, 0xFF,0xFF,0x00,
+  0xFF,0xFF, 0x81,0x81, 0xBD,0xBD, 0xA5,0xA5,
+  0xA5,0xA5, 0xBD,0xBD, 0x81,0x81, 0xFF,0xFF,
+};
+
+static uint16_t m_anRefFb[MOCK_DISP_W*MOCK_DISP_H];
+#if (DRV_HAS_READ_RECT)
+static uint32_t m_anCacheBuf[8192];   // Rendered element cache (32 KB)
+static uint32_t m_anSaveBuf[2048];    // Popup save-under (8 KB)
+#endif
+static int      m_nFail = 0;
+
+
+// ------------------------------------------------
+// Helpers
+// ------------------------------------------------
+
+// Report the bus activity of a check and whether the display
+// matches the reference frame buffer
+static void check_Report(const char* pName,bool bRef)
+{
+  bool bOk = true;
+  if (bRef) {
+    bOk = (memcmp(m_anRefFb,m_anMockFb,sizeof(m_anRefFb)) == 0);
+  }
+  if (m_sMockStats.bTxOpen) {
+    bOk = false;
+  }
+  printf("  %-28s tx=%-4u win=%-5u pixel=%-5u hline=%-4u %s\n",pName,
+    m_sMockStats.nTx,m_sMockStats.nWin,m_sMockStats.nWritePixel,m_sMockStats.nWriteHLine,
+    (bOk)? "OK" : "FAIL");
+  if (!bOk) {
+    m_nFail++;
+  }
+}
+
+#if (DRV_HAS_DRAW_POINTS)
+// Draw the points one at a time to produce the reference image
+static void check_DrawPointsRef(gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  memset(m_anMockFb,0,sizeof(m_anMockFb));
+  for (uint16_t nInd=0;nInd<nNumPt;nInd++) {
+    gslc_DrvDrawPoint(&m_gui,asPt[nInd].x,asPt[nInd].y,nCol);
+  }
+  memcpy(m_anRefFb,m_anMockFb,sizeof(m_anRefFb));
+  memset(m_anMockFb,0,sizeof(m_anMockFb));
+  mock_Reset();
+}
+
+// Draw the points with gslc_DrvDrawPoints() and compare
+static void check_DrawPoints(const char* pName,gslc_tsPt* asPt,uint16_t nNumPt)
+{
+  check_DrawPointsRef(asPt,nNumPt,GSLC_COL_WHITE);
+  gslc_DrvDrawPoints(&m_gui,asPt,nNumPt,GSLC_COL_WHITE);
+  check_Report(pName,true);
+}
+
+// Shuffle the points into a repeatable pseudo-random order
+static void check_Shuffle(gslc_tsPt* asPt,uint16_t nNumPt)
+{
+  srand(1);
+  for (uint16_t nInd=nNumPt-1;nInd>0;nInd--) {
+    uint16_t  nSwap = (uint16_t)(rand() % (nInd+1));
+    gslc_tsPt sPt   = asPt[nInd];
+    asPt[nInd]  = asPt[nSwap];
+    asPt[nSwap] = sPt;
+  }
+}
+#endif // DRV_HAS_DRAW_POINTS
+
+// Write a small 24-bit BMP file to be loaded through the SD card API
+static bool check_WriteBmp(const char* pFname)
+{
+  FILE* pFile = fopen(pFname,"wb");
+  if (pFile == NULL) {
+    return false;
+  }
+  uint32_t nRowLen = (BMP_W*3 + 3) & ~3u;
+  uint32_t nSize   = 54 + nRowLen*BMP_H;
+  uint8_t  acHdr[54] = {'B','M'};
+  acHdr[2]  = (uint8_t)(nSize);
+  acHdr[3]  = (uint8_t)(nSize >> 8);
+  acHdr[10] = 54;           // Offset to pixels
+  acHdr[14] = 40;           // Info header size
+  acHdr[18] = BMP_W;
+  acHdr[22] = BMP_H;
+  acHdr[26] = 1;            // Planes
+  acHdr[28] = 24;           // Bits per pixel
+  fwrite(acHdr,1,sizeof(acHdr),pFile);
+  for (uint16_t nRow=0;nRow<BMP_H;nRow++) {
+    for (uint32_t nCol=0;nCol<nRowLen;nCol++) {
+      fputc((int)((nRow*12 + nCol) & 0xFF),pFile);
+    }
+  }
+  fclose(pFile);
+  return true;
+}
+
+// Custom drawing that uses the shape primitives
+static bool check_CbDrawShapes(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
+{
+  gslc_tsGui*     pGui     = (gslc_tsGui*)(pvGui);
+  gslc_tsElemRef* pElemRef = (gslc_tsElemRef*)(pvElemRef);
+  gslc_tsRect     rElem    = gslc_ElemGetRect(pGui,pElemRef);
+  (void)eRedraw; // Unused
+
+  gslc_DrawFillRect(pGui,rElem,GSLC_COL_BLACK);
+  gslc_DrawFillCircle(pGui,rElem.x+15,rElem.y+15,10,GSLC_COL_RED);
+  gslc_DrawFrameCircle(pGui,rElem.x+45,rElem.y+15,10,GSLC_COL_GREEN);
+  gslc_DrawFillTriangle(pGui,rElem.x+60,rElem.y+25,rElem.x+70,rElem.y+5,rElem.x+80,rElem.y+25,GSLC_COL_BLUE);
+  gslc_DrawFrameTriangle(pGui,rElem.x+85,rElem.y+25,rElem.x+95,rElem.y+5,rElem.x+105,rElem.y+25,GSLC_COL_YELLOW);
+  gslc_DrawFrameRoundRect(pGui,(gslc_tsRect){(int16_t)(rElem.x+110),(int16_t)(rElem.y+5),30,20},4,GSLC_COL_WHITE);
+  gslc_DrawLine(pGui,rElem.x,rElem.y+29,rElem.x+rElem.w-1,rElem.y+29,GSLC_COL_GRAY);
+  return true;
+}
+
+
+// ------------------------------------------------
+// Checks
+// ------------------------------------------------
+
+#if (DRV_HAS_DRAW_POINTS)
+// gslc_DrvDrawPoints() merges points on the same row into runs
+static void check_Points()
+{
+  gslc_tsPt asPt[MAX_PT];
+  uint16_t  nNumPt;
+  int16_t   nX;
+
+  printf("gslc_DrvDrawPoints():\n");
+
+  // A row of points in order
+  nNumPt = 0;
+  for (nX=0;nX<100;nX++) {
+    asPt[nNumPt++] = (gslc_tsPt){(int16_t)(20+nX),10};
+  }
+  check_DrawPoints("row (ordered)",asPt,nNumPt);
+
+  // The same row in reverse
+  for (nX=0;nX<100;nX++) {
+    asPt[nX] = (gslc_tsPt){(int16_t)(119-nX),10};
+  }
+  check_DrawPoints("row (reversed)",asPt,nNumPt);
+
+  // A solid 20x8 block of points in random order
+  nNumPt = 0;
+  for (int16_t nY=0;nY<8;nY++) {
+    for (nX=0;nX<20;nX++) {
+      asPt[nNumPt++] = (gslc_tsPt){(int16_t)(50+nX),(int16_t)(40+nY)};
+    }
+  }
+  check_Shuffle(asPt,nNumPt);
+  check_DrawPoints("block (unsorted)",asPt,nNumPt);
+
+  // A thick dotted plot as produced by a graph or an antialiased
+  // custom draw: each column emits its points top to bottom
+  nNumPt = 0;
+  for (nX=0;nX<120;nX++) {
+    int16_t nY = (int16_t)(100 + (nX % 40) / 4);
+    asPt[nNumPt++] = (gslc_tsPt){(int16_t)(20+nX),nY};
+    asPt[nNumPt++] = (gslc_tsPt){(int16_t)(20+nX),(int16_t)(nY+1)};
+    asPt[nNumPt++] = (gslc_tsPt){(int16_t)(20+nX),(int16_t)(nY+2)};
+  }
+  check_DrawPoints("plot (column order)",asPt,nNumPt);
+
+  // Points outside the clipping region are discarded
+  gslc_tsRect rClip = {60,0,20,320};
+  gslc_DrvSetClipRect(&m_gui,&rClip);
+  check_DrawPointsRef(asPt,nNumPt,GSLC_COL_WHITE);
+  gslc_DrvDrawPoints(&m_gui,asPt,nNumPt,GSLC_COL_WHITE);
+  check_Report("plot (clipped)",true);
+  gslc_DrvSetClipRect(&m_gui,NULL);
+}
+#endif // DRV_HAS_DRAW_POINTS
+
+
+// A page redraw holds one transaction, except around the SD card
+// access, display reads and the display APIs that manage their own
+// transaction. The *_nobatch_lnx checks are built with
+// DRV_HAS_REDRAW_BATCH=0 to compare the bus activity without it.
+static void check_Redraw()
+{
+  gslc_tsElemRef* pElemRef;
+  gslc_tsElemRef* pElemRefTxt;
+  gslc_tsElemRef* pElemRefProg;
+  int16_t         nElemInd;
+  int16_t         nElemNum;
+  char            acTxt[8];
+
+  printf("Page redraw (DRV_HAS_REDRAW_BATCH=%d):\n",DRV_HAS_REDRAW_BATCH);
+
+  if (!check_WriteBmp(BMP_FNAME)) {
+    printf("  ERROR: can't write %s\n",BMP_FNAME);
+    m_nFail++;
+    return;
+  }
+
+  gslc_PageAdd(&m_gui,0,m_asElem,MAX_ELEM,m_asElemRef,MAX_ELEM);
+  gslc_SetBkgndColor(&m_gui,GSLC_COL_GRAY_DK2);
+
+  gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){10,10,220,60});
+  pElemRef = gslc_ElemCreateBtnTxt(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){20,20,80,30},"Button",0,0,NULL);
+  gslc_ElemSetRoundEn(&m_gui,pElemRef,true);
+  pElemRefTxt = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){120,25,60,12},"0",0,0);
+  pElemRefProg = gslc_ElemXProgressCreate(&m_gui,GSLC_ID_AUTO,0,&m_sXProgress,(gslc_tsRect){10,80,220,12},
+    0,100,0,GSLC_COL_GREEN,false);
+  pElemRef = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){10,100,150,30});
+  gslc_ElemSetDrawFunc(&m_gui,pElemRef,&check_CbDrawShapes);
+  gslc_ElemCreateImg(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){10,140,8,8},
+    gslc_GetImageFromProg((const unsigned char*)m_anImgColor,GSLC_IMGREF_FMT_BMP24));
+  gslc_ElemCreateImg(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){30,140,16,8},
+    gslc_GetImageFromProg(m_acImgMono,GSLC_IMGREF_FMT_RAW1));
+  gslc_ElemCreateImg(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){60,140,BMP_W,BMP_H},
+    gslc_GetImageFromSD(BMP_FNAME,GSLC_IMGREF_FMT_BMP24));
+  nElemNum = (int16_t)m_asPage[0].sCollect.nElemCnt;
+
+  // Popup
+  gslc_PageAdd(&m_gui,1,m_asElemPopup,MAX_ELEM_POPUP,m_asElemRefPopup,MAX_ELEM_POPUP);
+  gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,1,(gslc_tsRect){40,30,80,40});
+
+  gslc_SetPageCur(&m_gui,0);
+
+  // Reference: each element drawn on its own, outside of a redraw
+  mock_Reset();
+  gslc_DrvDrawBkgnd(&m_gui);
+  for (nElemInd=0;nElemInd<nElemNum;nElemInd++) {
+    gslc_ElemDraw(&m_gui,0,m_asElem[nElemInd].nId);
+  }
+  memcpy(m_anRefFb,m_anMockFb,sizeof(m_anRefFb));
+  memset(m_anMockFb,0,sizeof(m_anMockFb));
+
+  // The same page drawn by gslc_Update()
+  mock_Reset();
+  gslc_Update(&m_gui);
+  check_Report("full page",true);
+  printf("  %-28s %u (no transaction open)\n","SD card reads",m_sMockStats.nSdRead);
+
+  // Incremental updates of a text and a progress bar
+  mock_Reset();
+  for (uint16_t nUpdate=0;nUpdate<100;nUpdate++) {
+    snprintf(acTxt,sizeof(acTxt),"%u",nUpdate);
+    gslc_ElemSetTxtStr(&m_gui,pElemRefTxt,acTxt);
+    gslc_ElemXProgressSetVal(&m_gui,pElemRefProg,nUpdate);
+    gslc_Update(&m_gui);
+  }
+  check_Report("100 updates",false);
+
+#if (DRV_HAS_READ_RECT)
+  // Reading the display during a redraw releases the transaction
+  // - The cached elements are captured after they are drawn and
+  //   written back on the next redraw
+  gslc_ElemCacheSetBuf(&m_gui,(uint8_t*)m_anCacheBuf,sizeof(m_anCacheBuf));
+  gslc_ElemSetCacheEn(&m_gui,gslc_PageFindElemById(&m_gui,0,m_asElem[0].nId),true);
+  gslc_ElemSetCacheEn(&m_gui,pElemRefTxt,true);
+  gslc_ElemSetTxtStr(&m_gui,pElemRefTxt,"0");
+  gslc_ElemXProgressSetVal(&m_gui,pElemRefProg,0);
+  mock_Reset();
+  gslc_InvalidateRgnScreen(&m_gui);
+  gslc_PageRedrawSet(&m_gui,true);
+  gslc_Update(&m_gui);
+  check_Report("full page, cache capture",true);
+  printf("  %-28s %u (no transaction open)\n","display reads",m_sMockStats.nRead);
+  mock_Reset();
+  gslc_InvalidateRgnScreen(&m_gui);
+  gslc_PageRedrawSet(&m_gui,true);
+  gslc_Update(&m_gui);
+  check_Report("full page, cached",true);
+
+  // - The pixels under the popup are saved when it is drawn
+  //   and restored when it is hidden
+  gslc_PopupSetSaveBuf(&m_gui,(uint8_t*)m_anSaveBuf,sizeof(m_anSaveBuf));
+  mock_Reset();
+  gslc_PopupShow(&m_gui,1,true);
+  gslc_Update(&m_gui);
+  gslc_PopupHide(&m_gui);
+  gslc_Update(&m_gui);
+  check_Report("popup save-under",true);
+  printf("  %-28s %u (no transaction open)\n","display reads",m_sMockStats.nRead);
+  gslc_PopupSetSaveBuf(&m_gui,NULL,0);
+  gslc_ElemCacheSetBuf(&m_gui,NULL,0);
+#endif // DRV_HAS_READ_RECT
+
+  remove(BMP_FNAME);
+}
+
+
+#if (DRV_HAS_SPRITE) && (DRV_HAS_READ_RECT)
+// Reading and writing a region while a sprite is selected uses the
+// sprite (without any bus access) and is limited to its size
+static void check_SpriteRect()
+{
+  gslc_tsDrvSprite  sSprite;
+  gslc_tsRect       rSprite = {0,0,40,20};
+  uint16_t          anBuf[41*21];   // Room for the regions outside the sprite
+  bool              bOk = true;
+
+  printf("Sprite read/write rect:\n");
+
+  if (!gslc_DrvSpriteCreate(&m_gui,&sSprite,rSprite.w,rSprite.h)) {
+    printf("  ERROR: gslc_DrvSpriteCreate() failed\n");
+    m_nFail++;
+    return;
+  }
+  memcpy(m_anRefFb,m_anMockFb,sizeof(m_anRefFb));
+  mock_Reset();
+  gslc_DrvSpriteSelect(&m_gui,&sSprite);
+  gslc_DrvDrawFillRect(&m_gui,rSprite,GSLC_COL_BLUE);
+  gslc_DrvDrawFillRect(&m_gui,(gslc_tsRect){5,5,10,5},GSLC_COL_RED);
+  bOk &= gslc_DrvReadRect(&m_gui,rSprite,(uint8_t*)anBuf);
+  bOk &= !gslc_DrvReadRect(&m_gui,(gslc_tsRect){0,0,41,20},(uint8_t*)anBuf);
+  bOk &= !gslc_DrvReadRect(&m_gui,(gslc_tsRect){0,1,40,20},(uint8_t*)anBuf);
+  gslc_DrvDrawFillRect(&m_gui,rSprite,GSLC_COL_BLACK);
+  bOk &= gslc_DrvWriteRect(&m_gui,rSprite,(const uint8_t*)anBuf);
+  bOk &= !gslc_DrvWriteRect(&m_gui,(gslc_tsRect){1,0,40,20},(const uint8_t*)anBuf);
+  gslc_DrvSpriteSelect(&m_gui,NULL);
+  bOk &= (m_sMockStats.nTx == 0);
+  check_Report("draw in sprite",true);
+
+  // The restored sprite pushes the same pixels to the display
+  for (int16_t nY=0;nY<rSprite.h;nY++) {
+    for (int16_t nX=0;nX<rSprite.w;nX++) {
+      bool bRed = (nX >= 5) && (nX < 15) && (nY >= 5) && (nY < 10);
+      m_anRefFb[(100+nY)*MOCK_DISP_W+200+nX] = (bRed)? 0xF800 : 0x001F;
+    }
+  }
+  mock_Reset();
+  gslc_DrvSpritePush(&m_gui,&sSprite,200,100);
+  check_Report("push sprite",true);
+  gslc_DrvSpriteDestruct(&m_gui,&sSprite);
+
+  if (!bOk) {
+    printf("  ERROR: sprite region not read or written in the sprite\n");
+    m_nFail++;
+  }
+}
+#endif // DRV_HAS_SPRITE && DRV_HAS_READ_RECT
+
+
+int main(void)
+{
+  if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) {
+    printf("ERROR: gslc_Init() failed\n");
+    return 1;
+  }
+  // Use the built-in font of the display library
+  if (!gslc_FontSet(&m_gui,0,GSLC_FONTREF_PTR,NULL,1)) {
+    printf("ERROR: gslc_FontSet() failed\n");
+    return 1;
+  }
+
+#if (DRV_HAS_DRAW_POINTS)
+  check_Points();
+#endif
+  check_Redraw();
+#if (DRV_HAS_SPRITE) && (DRV_HAS_READ_RECT)
+  check_SpriteRect();
+#endif
+
+  gslc_Quit(&m_gui);
+
+  printf("%s\n",(m_nFail == 0)? "PASS" : "FAIL");
+  return (m_nFail == 0)? 0 : 1;
+}
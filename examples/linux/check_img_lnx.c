@@ -0,0 +1,550 @@
+//
+// GUIslice Library Examples
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Host check of the image paths (LINUX, memory framebuffer):
+//     Builds the core against the headless MEMFB driver and compares
+//     the pixels drawn by each image path with a reference.
+// - The RLE16 check writes BMP files, converts them with the bmp2rle
+//   tool and draws the generated arrays, which must match the same
+//   pixels drawn as a BMP24 image in memory.
+// - The BMP stream check reads BMP files through gslc_BmpStreamRead()
+//   with several buffer sizes and regions and reports the number of
+//   file reads and seeks.
+// - The popup check hides modal and modeless popups with and without
+//   a save-under buffer, which must leave the display as a full page
+//   redraw would, and reports the pixels written by the hide.
+//
+// - Build and run with "make check"
+//
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if !defined(DRV_DISP_MEMFB)
+  #error "check_img_lnx requires the MEMFB driver (make check)"
+#endif
+
+#if !defined(BMP2RLE)
+  #define BMP2RLE   "./bmp2rle"   // Path to the image converter (tools/bmp2rle.c)
+#endif
+
+#define MAX_PAGE    2
+#define MAX_FONT    1
+#define MAX_ELEM    4
+#define MAX_ELEM_POPUP 1
+
+#define IMG_W       37
+#define IMG_H       23
+#define IMG_FNAME   "check_img.bmp"   // BMP written for the checks
+#define RLE_FNAME   "check_img_rle.c" // Array generated by bmp2rle
+#define RLE_MAX     (2+2*IMG_W*IMG_H) // Upper limit of the encoded size (in words)
+
+gslc_tsGui      m_gui;
+gslc_tsDriver   m_drv;
+gslc_tsPage     m_asPage[MAX_PAGE];
+gslc_tsFont     m_asFont[MAX_FONT];
+gslc_tsElem     m_asElem[MAX_ELEM];
+gslc_tsElemRef  m_asElemRef[MAX_ELEM];
+gslc_tsElem     m_asElemPopup[MAX_ELEM_POPUP];
+gslc_tsElemRef  m_asElemRefPopup[MAX_ELEM_POPUP];
+
+static uint8_t  m_anImg[IMG_H][IMG_W][3];   // Source image (R,G,B)
+static uint16_t m_anBmp24[2+IMG_W*IMG_H];   // Source image as a BMP24 array in memory
+static uint16_t m_anRle[RLE_MAX];           // Array generated by bmp2rle
+static uint16_t m_anSaveBuf[200*120];       // Popup save-under (RGB565)
+static uint8_t* m_pRefFb = NULL;            // Reference frame buffer
+static uint32_t m_nCntRead = 0;             // File reads by the BMP stream
+static uint32_t m_nCntSeek = 0;             // File seeks by the BMP stream
+static int      m_nFail = 0;
+
+
+// ------------------------------------------------
+// Helpers
+// ------------------------------------------------
+
+static uint8_t* check_GetFb(size_t* pnLen)
+{
+  uint32_t nStride;
+  uint8_t* pFb = gslc_DrvGetFrameBuf(&m_gui,&nStride);
+  *pnLen = (size_t)nStride * m_gui.nDispH;
+  return pFb;
+}
+
+// Clear the frame buffer with the drivers and without clipping
+static void check_Clear()
+{
+  gslc_DrvSetClipRect(&m_gui,NULL);
+  gslc_DrvDrawFillRect(&m_gui,(gslc_tsRect){0,0,m_gui.nDispW,m_gui.nDispH},GSLC_COL_GRAY);
+}
+
+// Save the frame buffer as the reference
+static void check_CopyRef()
+{
+  size_t   nLen;
+  uint8_t* pFb = check_GetFb(&nLen);
+  memcpy(m_pRefFb,pFb,nLen);
+}
+
+// Save the frame buffer as the reference and clear it
+static void check_SaveRef()
+{
+  check_CopyRef();
+  check_Clear();
+}
+
+// Redraw the whole page stack
+static void check_PageRedraw()
+{
+  gslc_InvalidateRgnScreen(&m_gui);
+  gslc_PageRedrawSet(&m_gui,true);
+  gslc_Update(&m_gui);
+}
+
+static void check_ReportOk(const char* pName,const char* pInfo,bool bOk)
+{
+  printf("  %-28s %-36s %s\n",pName,pInfo,(bOk)? "OK" : "FAIL");
+  if (!bOk) {
+    m_nFail++;
+  }
+}
+
+// Report whether the frame buffer matches the reference and clear it
+static void check_Report(const char* pName,const char* pInfo)
+{
+  size_t   nLen;
+  uint8_t* pFb = check_GetFb(&nLen);
+  check_ReportOk(pName,pInfo,(memcmp(m_pRefFb,pFb,nLen) == 0));
+  check_Clear();
+}
+
+// Fill the source image with solid runs, noise and transparent areas
+static void check_MakeImg()
+{
+  srand(1);
+  for (int16_t nY=0;nY<IMG_H;nY++) {
+    for (int16_t nX=0;nX<IMG_W;nX++) {
+      uint8_t* pPix = m_anImg[nY][nX];
+      if ((nY == 3) || ((nX >= 20) && (nX < 26) && (nY > 10)) || ((nX + nY) % 17 == 0)) {
+        // Transparency color (GSLC_BMP_TRANS_RGB)
+        pPix[0] = 0xFF; pPix[1] = 0x00; pPix[2] = 0xFF;
+      } else if (nX < 12) {
+        // Solid runs that change color each row
+        pPix[0] = (uint8_t)(nY * 11); pPix[1] = 0x80; pPix[2] = (uint8_t)(255 - nY * 11);
+      } else {
+        pPix[0] = (uint8_t)rand(); pPix[1] = (uint8_t)rand(); pPix[2] = (uint8_t)rand();
+      }
+    }
+  }
+  m_anBmp24[0] = IMG_H;
+  m_anBmp24[1] = IMG_W;
+  for (int16_t nY=0;nY<IMG_H;nY++) {
+    for (int16_t nX=0;nX<IMG_W;nX++) {
+      uint8_t* pPix = m_anImg[nY][nX];
+      m_anBmp24[2+nY*IMG_W+nX] = (uint16_t)(((pPix[0] & 0xF8) << 8) | ((pPix[1] & 0xFC) << 3) | (pPix[2] >> 3));
+    }
+  }
+}
+
+static void check_PutLE(FILE* pFile,uint32_t nVal,int nBytes)
+{
+  for (int nInd=0;nInd<nBytes;nInd++) {
+    fputc((int)((nVal >> (nInd*8)) & 0xFF),pFile);
+  }
+}
+
+// Write the source image as a BMP file
+// - nDepth: 24 or 32 bits per pixel
+// - bTopDown: rows are stored top to bottom (negative height)
+// - anMask: channel masks for a 32-bit BI_BITFIELDS file (or NULL)
+static bool check_WriteBmp(const char* pFname,uint16_t nDepth,bool bTopDown,const uint32_t* anMask)
+{
+  FILE* pFile = fopen(pFname,"wb");
+  if (pFile == NULL) {
+    return false;
+  }
+  uint32_t nPixBytes = nDepth / 8;
+  uint32_t nRowLen   = (IMG_W*nPixBytes + 3) & ~3u;
+  uint32_t nOffset   = 54 + ((anMask)? 12 : 0);
+  fputc('B',pFile);
+  fputc('M',pFile);
+  check_PutLE(pFile,nOffset + nRowLen*IMG_H,4);
+  check_PutLE(pFile,0,4);
+  check_PutLE(pFile,nOffset,4);
+  check_PutLE(pFile,40,4);                                  // Info header size
+  check_PutLE(pFile,IMG_W,4);
+  check_PutLE(pFile,(bTopDown)? (uint32_t)(-IMG_H) : IMG_H,4);
+  check_PutLE(pFile,1,2);                                   // Planes
+  check_PutLE(pFile,nDepth,2);
+  check_PutLE(pFile,(anMask)? 3 : 0,4);                     // Compression
+  for (int nInd=0;nInd<5;nInd++) {
+    check_PutLE(pFile,0,4);
+  }
+  for (int nInd=0;(anMask) && (nInd<3);nInd++) {
+    check_PutLE(pFile,anMask[nInd],4);
+  }
+  for (int16_t nRow=0;nRow<IMG_H;nRow++) {
+    int16_t nY = (bTopDown)? nRow : IMG_H-1-nRow;
+    for (int16_t nX=0;nX<IMG_W;nX++) {
+      uint8_t* pPix = m_anImg[nY][nX];
+      if (anMask) {
+        uint32_t nPix = 0;
+        for (int nInd=0;nInd<3;nInd++) {
+          uint32_t nShift = 0;
+          while (((anMask[nInd] >> nShift) & 1) == 0) { nShift++; }
+          nPix |= (uint32_t)pPix[nInd] << nShift;
+        }
+        check_PutLE(pFile,nPix,4);
+      } else {
+        // B,G,R(,A)
+        fputc(pPix[2],pFile);
+        fputc(pPix[1],pFile);
+        fputc(pPix[0],pFile);
+        if (nPixBytes == 4) { fputc(0,pFile); }
+      }
+    }
+    for (uint32_t nPad=IMG_W*nPixBytes;nPad<nRowLen;nPad++) {
+      fputc(0,pFile);
+    }
+  }
+  fclose(pFile);
+  return true;
+}
+
+// Convert a BMP file with bmp2rle and load the generated array
+// - Returns the number of words in the array (0 if failed)
+static uint32_t check_LoadRle(const char* pFnameBmp)
+{
+  char acCmd[256];
+  snprintf(acCmd,sizeof(acCmd),"%s -n check_rle %s %s > /dev/null",BMP2RLE,pFnameBmp,RLE_FNAME);
+  if (system(acCmd) != 0) {
+    return 0;
+  }
+  FILE* pFile = fopen(RLE_FNAME,"r");
+  if (pFile == NULL) {
+    return 0;
+  }
+  // The array follows the opening brace and holds the height and
+  // width (decimal) and then the runs (hexadecimal)
+  uint32_t  nLen = 0;
+  char      acLine[256];
+  bool      bData = false;
+  while ((fgets(acLine,sizeof(acLine),pFile) != NULL) && (nLen < RLE_MAX)) {
+    if (!bData) {
+      bData = (strchr(acLine,'{') != NULL);
+      continue;
+    }
+    char* pCur = acLine;
+    char* pEnd;
+    while (nLen < RLE_MAX) {
+      while ((*pCur == ' ') || (*pCur == ',')) { pCur++; }
+      if ((*pCur == '/') || (*pCur == '}')) {
+        break;
+      }
+      unsigned long nVal = strtoul(pCur,&pEnd,0);
+      if (pEnd == pCur) {
+        break;
+      }
+      m_anRle[nLen++] = (uint16_t)nVal;
+      pCur = pEnd;
+    }
+  }
+  fclose(pFile);
+  remove(RLE_FNAME);
+  return nLen;
+}
+
+
+// File callbacks for the BMP stream
+static int32_t check_FileRead(void* pvFile,uint8_t* pBuf,uint16_t nLen)
+{
+  m_nCntRead++;
+  return (int32_t)fread(pBuf,1,nLen,(FILE*)pvFile);
+}
+
+static bool check_FileSeek(void* pvFile,uint32_t nPos)
+{
+  m_nCntSeek++;
+  return (fseek((FILE*)pvFile,(long)nPos,SEEK_SET) == 0);
+}
+
+// Stream a region of a BMP file and compare it with the source image
+// - Returns the number of pixels that matched, or -1 if the runs
+//   were not returned from top to bottom and left to right
+static int32_t check_StreamBmp(const char* pFname,uint16_t nBufLen,gslc_tsRect* pRegion)
+{
+  static uint8_t    acBuf[4096];
+  gslc_tsBmpStream  sStream;
+  int32_t           nMatch = 0;
+  int16_t           nX,nY;
+  int16_t           nNextX = -1;
+  int16_t           nNextY = -1;
+  uint16_t          nCnt;
+  const uint8_t*    pPix;
+
+  FILE* pFile = fopen(pFname,"rb");
+  if (pFile == NULL) {
+    return -1;
+  }
+  m_nCntRead = 0;
+  m_nCntSeek = 0;
+  if (!gslc_BmpStreamOpen(&sStream,pFile,&check_FileRead,&check_FileSeek,acBuf,nBufLen)) {
+    fclose(pFile);
+    return -1;
+  }
+  if (pRegion) {
+    gslc_BmpStreamSetRegion(&sStream,*pRegion);
+  }
+  gslc_tsRect rRegion = sStream.rRegion;
+  nNextX = rRegion.x;
+  nNextY = rRegion.y;
+  while ((nCnt = gslc_BmpStreamRead(&sStream,&nX,&nY,&pPix)) > 0) {
+    if ((nX != nNextX) || (nY != nNextY) || (nX + nCnt > rRegion.x + (int16_t)rRegion.w)) {
+      nMatch = -1;
+      break;
+    }
+    for (uint16_t nInd=0;nInd<nCnt;nInd++,pPix+=sStream.nPixBytes) {
+      uint8_t* pSrc = m_anImg[nY][nX+nInd];
+      if ((pPix[0] == pSrc[2]) && (pPix[1] == pSrc[1]) && (pPix[2] == pSrc[0])) {
+        nMatch++;
+      }
+    }
+    nNextX = nX + nCnt;
+    if (nNextX == rRegion.x + (int16_t)rRegion.w) {
+      nNextX = rRegion.x;
+      nNextY++;
+    }
+  }
+  fclose(pFile);
+  return nMatch;
+}
+
+
+// ------------------------------------------------
+// Checks
+// ------------------------------------------------
+
+// Images converted by bmp2rle decode to the same pixels as BMP24
+static void check_Rle16()
+{
+  static const uint32_t anMaskRgba[3] = { 0xFF000000, 0x00FF0000, 0x0000FF00 };
+  static const uint32_t anMaskBgra[3] = { 0x00FF0000, 0x0000FF00, 0x000000FF };
+  static const struct {
+    const char*     pName;
+    uint16_t        nDepth;
+    bool            bTopDown;
+    const uint32_t* anMask;
+  } asBmp[] = {
+    { "24-bit, bottom-up",  24, false, NULL },
+    { "32-bit, top-down",   32, true,  NULL },
+    { "32-bit, BITFIELDS",  32, false, anMaskBgra },
+    { "32-bit, BITFIELDS RGBA", 32, false, anMaskRgba },
+  };
+  const gslc_tsRect asClip[] = {
+    { 0, 0, 480, 320 },
+    { 25, 15, 20, 9 },
+  };
+  gslc_tsImgRef sImgBmp24 = gslc_GetImageFromRam((unsigned char*)m_anBmp24,GSLC_IMGREF_FMT_BMP24);
+  gslc_tsImgRef sImgRle   = gslc_GetImageFromRam((unsigned char*)m_anRle,GSLC_IMGREF_FMT_RLE16);
+  char          acInfo[64];
+
+  printf("RLE16 images from bmp2rle:\n");
+
+  for (unsigned nBmp=0;nBmp<sizeof(asBmp)/sizeof(asBmp[0]);nBmp++) {
+    uint32_t nLen = 0;
+    if (check_WriteBmp(IMG_FNAME,asBmp[nBmp].nDepth,asBmp[nBmp].bTopDown,asBmp[nBmp].anMask)) {
+      nLen = check_LoadRle(IMG_FNAME);
+    }
+    remove(IMG_FNAME);
+    if ((nLen < 2) || (m_anRle[0] != IMG_H) || (m_anRle[1] != IMG_W)) {
+      printf("  %-28s ERROR: conversion with %s failed\n",asBmp[nBmp].pName,BMP2RLE);
+      m_nFail++;
+      continue;
+    }
+    for (unsigned nClip=0;nClip<sizeof(asClip)/sizeof(asClip[0]);nClip++) {
+      gslc_DrvSetClipRect(&m_gui,(gslc_tsRect*)&asClip[nClip]);
+      gslc_DrvDrawImage(&m_gui,20,10,sImgBmp24);
+      gslc_DrvDrawImage(&m_gui,460,300,sImgBmp24);
+      check_SaveRef();
+      gslc_DrvSetClipRect(&m_gui,(gslc_tsRect*)&asClip[nClip]);
+      gslc_DrvDrawImage(&m_gui,20,10,sImgRle);
+      gslc_DrvDrawImage(&m_gui,460,300,sImgRle);
+      snprintf(acInfo,sizeof(acInfo),"%u of %u bytes%s",(unsigned)(nLen*2),(unsigned)sizeof(m_anBmp24),
+        (nClip > 0)? ", clipped" : "");
+      check_Report(asBmp[nBmp].pName,acInfo);
+    }
+  }
+  gslc_DrvSetClipRect(&m_gui,NULL);
+}
+
+// Rows and pieces of rows streamed from BMP files
+static void check_BmpStream()
+{
+  static const struct {
+    const char*     pName;
+    uint16_t        nDepth;
+    bool            bTopDown;
+  } asBmp[] = {
+    { "24-bit, bottom-up",  24, false },
+    { "32-bit, top-down",   32, true  },
+  };
+  // Buffers that hold part of a row, one row, several rows and the image
+  static const uint16_t anBufLen[] = { 54, 128, 600, 4096 };
+  gslc_tsRect   rRegion = { 5, 4, 20, 9 };
+  gslc_tsRect   rBeyond = { 30, 18, 20, 20 };
+  char          acName[64];
+  char          acInfo[64];
+  int32_t       nMatch;
+
+  printf("BMP row streaming:\n");
+
+  for (unsigned nBmp=0;nBmp<sizeof(asBmp)/sizeof(asBmp[0]);nBmp++) {
+    if (!check_WriteBmp(IMG_FNAME,asBmp[nBmp].nDepth,asBmp[nBmp].bTopDown,NULL)) {
+      printf("  %-28s ERROR: can't write %s\n",asBmp[nBmp].pName,IMG_FNAME);
+      m_nFail++;
+      continue;
+    }
+    for (unsigned nBuf=0;nBuf<sizeof(anBufLen)/sizeof(anBufLen[0]);nBuf++) {
+      snprintf(acName,sizeof(acName),"%s, buf %u",asBmp[nBmp].pName,anBufLen[nBuf]);
+      nMatch = check_StreamBmp(IMG_FNAME,anBufLen[nBuf],NULL);
+      snprintf(acInfo,sizeof(acInfo),"image:  reads=%-4u seeks=%u",(unsigned)m_nCntRead,(unsigned)m_nCntSeek);
+      check_ReportOk(acName,acInfo,(nMatch == IMG_W*IMG_H));
+      nMatch = check_StreamBmp(IMG_FNAME,anBufLen[nBuf],&rRegion);
+      snprintf(acInfo,sizeof(acInfo),"region: reads=%-4u seeks=%u",(unsigned)m_nCntRead,(unsigned)m_nCntSeek);
+      check_ReportOk(acName,acInfo,(nMatch == rRegion.w*rRegion.h));
+    }
+    // Regions are limited to the image
+    nMatch = check_StreamBmp(IMG_FNAME,600,&rBeyond);
+    check_ReportOk(asBmp[nBmp].pName,"region beyond the image",(nMatch == (IMG_W-rBeyond.x)*(IMG_H-rBeyond.y)));
+
+    // The MEMFB driver loads files through the same stream
+    gslc_tsImgRef sImgFile = gslc_GetImageFromFile(IMG_FNAME,GSLC_IMGREF_FMT_BMP24);
+    gslc_tsImgRef sImgMem  = gslc_GetImageFromRam((unsigned char*)m_anBmp24,GSLC_IMGREF_FMT_BMP24);
+    sImgFile.pvImgRaw = gslc_DrvLoadImage(&m_gui,sImgFile);
+    gslc_DrvDrawImage(&m_gui,20,10,sImgMem);
+    check_SaveRef();
+    if (sImgFile.pvImgRaw) {
+      gslc_DrvDrawImage(&m_gui,20,10,sImgFile);
+      gslc_DrvImageDestruct(sImgFile.pvImgRaw);
+    }
+    // With DRV_MEMFB_DEPTH 24 the file keeps all 8 bits of each channel,
+    // so compare at the precision of the RGB565 BMP24 image
+    size_t   nLen;
+    uint8_t* pFb = check_GetFb(&nLen);
+    for (size_t nInd=0;nInd<nLen;nInd++) {
+      pFb[nInd] &= 0xF8;
+      m_pRefFb[nInd] &= 0xF8;
+    }
+    check_Report(asBmp[nBmp].pName,"MEMFB image file");
+  }
+  remove(IMG_FNAME);
+
+  // A truncated file ends the stream without reading past the buffer
+  if (check_WriteBmp(IMG_FNAME,24,false,NULL) && (truncate(IMG_FNAME,54+112*10+50) == 0)) {
+    nMatch = check_StreamBmp(IMG_FNAME,54,NULL);
+    check_ReportOk("24-bit, truncated","",(nMatch >= 0) && (nMatch < IMG_W*IMG_H));
+  }
+  remove(IMG_FNAME);
+}
+
+// Hide a popup and compare the display with a full page redraw
+// - bSave:   restore the pixels saved under the popup
+// - bModal:  modal popup (the base page isn't redrawn while it is shown)
+// - bChange: change an element under the popup while it is shown
+static void check_PopupHide(const char* pName,bool bSave,bool bModal,bool bChange)
+{
+  gslc_tsElemRef*   pElemRefUnder = &m_asElemRef[1];
+  gslc_tsDrvStats   sStats;
+  char              acInfo[64];
+
+  gslc_PopupSetSaveBuf(&m_gui,(bSave)? (uint8_t*)m_anSaveBuf : NULL,sizeof(m_anSaveBuf));
+  gslc_ElemSetCol(&m_gui,pElemRefUnder,GSLC_COL_WHITE,GSLC_COL_GREEN,GSLC_COL_GREEN);
+  check_PageRedraw();
+
+  gslc_PopupShow(&m_gui,1,bModal);
+  gslc_Update(&m_gui);
+  if (bChange) {
+    gslc_ElemSetCol(&m_gui,pElemRefUnder,GSLC_COL_WHITE,GSLC_COL_YELLOW,GSLC_COL_YELLOW);
+    gslc_Update(&m_gui);
+  }
+
+  gslc_DrvResetStats(&m_gui);
+  gslc_PopupHide(&m_gui);
+  gslc_Update(&m_gui);
+  gslc_DrvGetStats(&m_gui,&sStats);
+
+  // The reference is the same page stack redrawn in full
+  size_t   nLen;
+  uint8_t* pFb = check_GetFb(&nLen);
+  check_CopyRef();
+  check_PageRedraw();
+  bool bOk = (memcmp(m_pRefFb,pFb,nLen) == 0);
+  // The saved pixels must have been used
+  if (bSave && (sStats.nCntWriteRect != 1)) {
+    bOk = false;
+  }
+  snprintf(acInfo,sizeof(acInfo),"hide: pixels=%-6u restores=%u",(unsigned)sStats.nPixels,(unsigned)sStats.nCntWriteRect);
+  check_ReportOk(pName,acInfo,bOk);
+}
+
+// Popups hidden with and without save-under
+static void check_Popup()
+{
+  printf("Popup save-under:\n");
+
+  gslc_PageAdd(&m_gui,0,m_asElem,MAX_ELEM,m_asElemRef,MAX_ELEM);
+  gslc_PageAdd(&m_gui,1,m_asElemPopup,MAX_ELEM_POPUP,m_asElemRefPopup,MAX_ELEM_POPUP);
+  gslc_SetBkgndColor(&m_gui,GSLC_COL_GRAY_DK2);
+  // Base page elements: partly under, under and away from the popup
+  gslc_ElemSetCol(&m_gui,gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){20,20,200,100}),
+    GSLC_COL_WHITE,GSLC_COL_BLUE,GSLC_COL_BLUE);
+  gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){150,110,120,60});
+  gslc_ElemSetCol(&m_gui,gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,0,(gslc_tsRect){330,220,100,60}),
+    GSLC_COL_WHITE,GSLC_COL_RED,GSLC_COL_RED);
+  // Popup
+  gslc_ElemSetCol(&m_gui,gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,1,(gslc_tsRect){120,80,200,120}),
+    GSLC_COL_YELLOW,GSLC_COL_BLACK,GSLC_COL_BLACK);
+  gslc_SetPageCur(&m_gui,0);
+
+  check_PopupHide("modal, redraw",false,true,false);
+  check_PopupHide("modal, save-under",true,true,false);
+  check_PopupHide("modal, change, redraw",false,true,true);
+  check_PopupHide("modal, change, save-under",true,true,true);
+  check_PopupHide("modeless, change, redraw",false,false,true);
+  check_PopupHide("modeless, change, save-under",true,false,true);
+
+  gslc_PopupSetSaveBuf(&m_gui,NULL,0);
+  check_Clear();
+}
+
+
+int main(void)
+{
+  if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) {
+    printf("ERROR: gslc_Init() failed\n");
+    return 1;
+  }
+  size_t nLen;
+  check_GetFb(&nLen);
+  m_pRefFb = (uint8_t*)malloc(nLen);
+  if (m_pRefFb == NULL) {
+    printf("ERROR: out of memory\n");
+    return 1;
+  }
+  check_Clear();
+
+  check_MakeImg();
+  check_Rle16();
+  check_BmpStream();
+  check_Popup();
+
+  free(m_pRefFb);
+  gslc_Quit(&m_gui);
+
+  printf("%s\n",(m_nFail == 0)? "PASS" : "FAIL");
+  return (m_nFail == 0)? 0 : 1;
+}
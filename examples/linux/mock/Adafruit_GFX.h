@@ -0,0 +1,143 @@
+#ifndef _MOCK_ADAFRUIT_GFX_H_
+#define _MOCK_ADAFRUIT_GFX_H_
+
+// =======================================================================
+// Host-side mock of Adafruit_GFX
+// - Records bus transactions and address windows in m_sMockStats
+// - Enforces the transaction rules of the real library:
+//   - startWrite() / endWrite() do not nest, so calling startWrite()
+//     (or any API that opens its own transaction, such as the draw*()
+//     and fill*() calls and text output) while a transaction is open
+//     is an error
+//   - The write*() APIs may only be called inside a transaction
+// - Shapes other than pixels, lines and rectangles only mark their
+//   bounding box in the frame buffer
+// =======================================================================
+
+#include <Arduino.h>
+#include "gfxfont.h"
+#include "mock_disp.h"
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w,int16_t h) : _width(w),_height(h),_cursor_x(0),_cursor_y(0) {}
+
+  // Transactions
+  virtual void startWrite() {
+    if (m_sMockStats.bTxOpen) { mock_Fail("nested startWrite()"); }
+    m_sMockStats.bTxOpen = true;
+    m_sMockStats.nTx++;
+  }
+  virtual void endWrite() {
+    if (!m_sMockStats.bTxOpen) { mock_Fail("endWrite() without startWrite()"); }
+    m_sMockStats.bTxOpen = false;
+  }
+
+  // Drawing within a transaction
+  virtual void writePixel(int16_t x,int16_t y,uint16_t c) {
+    mockChkTx();
+    m_sMockStats.nWritePixel++;
+    m_sMockStats.nWin++;
+    mockPlot(x,y,c);
+  }
+  virtual void writeFillRect(int16_t x,int16_t y,int16_t w,int16_t h,uint16_t c) {
+    mockChkTx();
+    m_sMockStats.nWin++;
+    for (int16_t j=0;j<h;j++) { for (int16_t i=0;i<w;i++) { mockPlot(x+i,y+j,c); } }
+  }
+  virtual void writeFastHLine(int16_t x,int16_t y,int16_t w,uint16_t c) {
+    m_sMockStats.nWriteHLine++;
+    writeFillRect(x,y,w,1,c);
+  }
+  virtual void writeFastVLine(int16_t x,int16_t y,int16_t h,uint16_t c) { writeFillRect(x,y,1,h,c); }
+  virtual void writeLine(int16_t x0,int16_t y0,int16_t x1,int16_t y1,uint16_t c) {
+    // Bresenham, one address window per pixel as in the real library
+    int16_t dx = abs(x1-x0), sx = (x0<x1)? 1 : -1;
+    int16_t dy = -abs(y1-y0), sy = (y0<y1)? 1 : -1;
+    int16_t err = dx+dy;
+    while (true) {
+      writePixel(x0,y0,c);
+      if ((x0 == x1) && (y0 == y1)) { break; }
+      int16_t e2 = 2*err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+
+  // APIs that open their own transaction
+  virtual void drawPixel(int16_t x,int16_t y,uint16_t c) { startWrite(); writePixel(x,y,c); endWrite(); }
+  virtual void fillRect(int16_t x,int16_t y,int16_t w,int16_t h,uint16_t c) { startWrite(); writeFillRect(x,y,w,h,c); endWrite(); }
+  virtual void drawFastHLine(int16_t x,int16_t y,int16_t w,uint16_t c) { startWrite(); writeFastHLine(x,y,w,c); endWrite(); }
+  virtual void drawFastVLine(int16_t x,int16_t y,int16_t h,uint16_t c) { startWrite(); writeFastVLine(x,y,h,c); endWrite(); }
+  virtual void drawLine(int16_t x0,int16_t y0,int16_t x1,int16_t y1,uint16_t c) { startWrite(); writeLine(x0,y0,x1,y1,c); endWrite(); }
+  virtual void fillScreen(uint16_t c) { fillRect(0,0,_width,_height,c); }
+  void drawRect(int16_t x,int16_t y,int16_t w,int16_t h,uint16_t c) {
+    startWrite();
+    writeFastHLine(x,y,w,c); writeFastHLine(x,y+h-1,w,c);
+    writeFastVLine(x,y,h,c); writeFastVLine(x+w-1,y,h,c);
+    endWrite();
+  }
+  void drawRoundRect(int16_t x,int16_t y,int16_t w,int16_t h,int16_t r,uint16_t c) { (void)r; drawRect(x,y,w,h,c); }
+  void fillRoundRect(int16_t x,int16_t y,int16_t w,int16_t h,int16_t r,uint16_t c) { (void)r; fillRect(x,y,w,h,c); }
+  void drawCircle(int16_t x,int16_t y,int16_t r,uint16_t c) { drawRect(x-r,y-r,2*r+1,2*r+1,c); }
+  void fillCircle(int16_t x,int16_t y,int16_t r,uint16_t c) { fillRect(x-r,y-r,2*r+1,2*r+1,c); }
+  void drawTriangle(int16_t x0,int16_t y0,int16_t x1,int16_t y1,int16_t x2,int16_t y2,uint16_t c) {
+    startWrite(); writeLine(x0,y0,x1,y1,c); writeLine(x1,y1,x2,y2,c); writeLine(x2,y2,x0,y0,c); endWrite();
+  }
+  void fillTriangle(int16_t x0,int16_t y0,int16_t x1,int16_t y1,int16_t x2,int16_t y2,uint16_t c) { drawTriangle(x0,y0,x1,y1,x2,y2,c); }
+  void drawRGBBitmap(int16_t x,int16_t y,const uint16_t* pBmp,int16_t w,int16_t h) {
+    startWrite();
+    for (int16_t j=0;j<h;j++) { for (int16_t i=0;i<w;i++) { writePixel(x+i,y+j,pgm_read_word(&pBmp[j*w+i])); } }
+    endWrite();
+  }
+  void drawRGBBitmap(int16_t x,int16_t y,uint16_t* pBmp,int16_t w,int16_t h) { drawRGBBitmap(x,y,(const uint16_t*)pBmp,w,h); }
+  void drawBitmap(int16_t x,int16_t y,const uint8_t* pBmp,int16_t w,int16_t h,uint16_t c) {
+    startWrite();
+    for (int16_t j=0;j<h;j++) {
+      for (int16_t i=0;i<w;i++) {
+        if (pgm_read_byte(&pBmp[j*((w+7)/8)+i/8]) & (0x80 >> (i&7))) { writePixel(x+i,y+j,c); }
+      }
+    }
+    endWrite();
+  }
+  void drawBitmap(int16_t x,int16_t y,const uint8_t* pBmp,int16_t w,int16_t h,uint16_t c,uint16_t bg) {
+    (void)bg;
+    drawBitmap(x,y,pBmp,w,h,c);
+  }
+
+  // Text: each character is drawn in its own transaction (a 6x8 cell)
+  virtual size_t write(uint8_t ch) {
+    if (ch == '\n') { _cursor_x = 0; _cursor_y += 8; return 1; }
+    fillRect(_cursor_x,_cursor_y,5,7,0xFFFF);
+    _cursor_x += 6;
+    return 1;
+  }
+  void setFont(const GFXfont* pFont=NULL) { (void)pFont; }
+  void setTextColor(uint16_t c) { (void)c; }
+  void setTextColor(uint16_t c,uint16_t bg) { (void)c; (void)bg; }
+  void setTextSize(uint8_t s) { (void)s; }
+  void setTextWrap(bool b) { (void)b; }
+  void cp437(bool b) { (void)b; }
+  void setCursor(int16_t x,int16_t y) { _cursor_x = x; _cursor_y = y; }
+  int16_t getCursorX() const { return _cursor_x; }
+  int16_t getCursorY() const { return _cursor_y; }
+  void getTextBounds(const char* pStr,int16_t x,int16_t y,int16_t* x1,int16_t* y1,uint16_t* w,uint16_t* h) {
+    *x1 = x; *y1 = y; *w = 6*strlen(pStr); *h = 8;
+  }
+  void setRotation(uint8_t r) { (void)r; }
+  void invertDisplay(bool b) { (void)b; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+protected:
+  void mockChkTx() { if (!m_sMockStats.bTxOpen) { mock_Fail("write*() outside of a transaction"); } }
+  void mockPlot(int16_t x,int16_t y,uint16_t c) {
+    m_sMockStats.nPixels++;
+    if ((x >= 0) && (y >= 0) && (x < MOCK_DISP_W) && (y < MOCK_DISP_H)) { m_anMockFb[y*MOCK_DISP_W+x] = c; }
+  }
+
+  int16_t _width,_height;
+  int16_t _cursor_x,_cursor_y;
+};
+
+#endif // _MOCK_ADAFRUIT_GFX_H_
@@ -0,0 +1,53 @@
+#ifndef _MOCK_ADAFRUIT_ILI9341_H_
+#define _MOCK_ADAFRUIT_ILI9341_H_
+
+// =======================================================================
+// Host-side mock of Adafruit_ILI9341 (an Adafruit_SPITFT display)
+// - Adds the address window block transfer APIs
+// =======================================================================
+
+#include "Adafruit_GFX.h"
+
+#define ILI9341_TFTWIDTH    240
+#define ILI9341_TFTHEIGHT   320
+#define ILI9341_RDMODE      0x0A
+#define ILI9341_RDMADCTL    0x0B
+#define ILI9341_RDPIXFMT    0x0C
+#define ILI9341_RDIMGFMT    0x0D
+#define ILI9341_RDSELFDIAG  0x0F
+
+class Adafruit_ILI9341 : public Adafruit_GFX {
+public:
+  Adafruit_ILI9341(int8_t cs,int8_t dc,int8_t rst=-1) : Adafruit_GFX(ILI9341_TFTWIDTH,ILI9341_TFTHEIGHT) { (void)cs; (void)dc; (void)rst; }
+  Adafruit_ILI9341(int8_t cs,int8_t dc,int8_t mosi,int8_t sclk,int8_t rst,int8_t miso)
+    : Adafruit_GFX(ILI9341_TFTWIDTH,ILI9341_TFTHEIGHT) { (void)cs; (void)dc; (void)mosi; (void)sclk; (void)rst; (void)miso; }
+  void begin(uint32_t nFreq=0) { (void)nFreq; }
+  uint8_t readcommand8(uint8_t nCmd,uint8_t nInd=0) { (void)nCmd; (void)nInd; return 0; }
+
+  void setAddrWindow(uint16_t x,uint16_t y,uint16_t w,uint16_t h) {
+    mockChkTx();
+    m_sMockStats.nWin++;
+    _win_x = x; _win_y = y; _win_w = w; _win_h = h;
+    _win_pos = 0;
+  }
+  void writePixels(uint16_t* pColors,uint32_t nLen,bool bBlock=true,bool bBigEndian=false) {
+    (void)bBlock; (void)bBigEndian;
+    mockChkTx();
+    for (uint32_t nInd=0;nInd<nLen;nInd++,_win_pos++) {
+      if (_win_pos >= (uint32_t)_win_w*_win_h) { mock_Fail("writePixels() overflows the address window"); }
+      mockPlot(_win_x + _win_pos % _win_w,_win_y + _win_pos / _win_w,pColors[nInd]);
+    }
+  }
+  void writeColor(uint16_t nColor,uint32_t nLen) {
+    mockChkTx();
+    for (uint32_t nInd=0;nInd<nLen;nInd++,_win_pos++) {
+      mockPlot(_win_x + _win_pos % _win_w,_win_y + _win_pos / _win_w,nColor);
+    }
+  }
+
+private:
+  uint16_t _win_x = 0, _win_y = 0, _win_w = 0, _win_h = 0;
+  uint32_t _win_pos = 0;
+};
+
+#endif // _MOCK_ADAFRUIT_ILI9341_H_
@@ -0,0 +1,72 @@
+#ifndef _MOCK_ARDUINO_H_
+#define _MOCK_ARDUINO_H_
+
+// =======================================================================
+// Host-side mock of the subset of the Arduino runtime used by GUIslice
+// =======================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ARDUINO 10800
+
+#define PROGMEM
+#define pgm_read_byte(a)    (*(const uint8_t*)(a))
+#define pgm_read_word(a)    (*(const uint16_t*)(a))
+#define pgm_read_dword(a)   (*(const uint32_t*)(a))
+#define pgm_read_pointer(a) (*(void* const*)(a))
+#define F(x)                x
+#define PSTR(x)             x
+#define strlen_P            strlen
+#define strncpy_P           strncpy
+#define strcpy_P            strcpy
+#define memcpy_P            memcpy
+#define __FlashStringHelper char
+
+#define INPUT   0
+#define OUTPUT  1
+#define HIGH    1
+#define LOW     0
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+unsigned long millis(void);
+void delay(unsigned long nMs);
+void pinMode(int nPin,int nMode);
+int  digitalRead(int nPin);
+void digitalWrite(int nPin,int nVal);
+int  analogRead(int nPin);
+#ifdef __cplusplus
+}
+
+struct SerialStub {
+  void begin(long nBaud) { (void)nBaud; }
+  int  print(const char* pStr) { return printf("%s",pStr); }
+  int  println(const char* pStr) { return printf("%s\n",pStr); }
+  int  print(int nVal) { return printf("%d",nVal); }
+  int  println(int nVal) { return printf("%d\n",nVal); }
+  int  println() { return printf("\n"); }
+  int  write(char ch) { return putchar(ch); }
+  int  available() { return 0; }
+  int  read() { return -1; }
+  operator bool() { return true; }
+};
+extern SerialStub Serial;
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t ch) = 0;
+  size_t print(char ch) { return write((uint8_t)ch); }
+  size_t print(const char* pStr) { size_t nLen = 0; while (*pStr) { nLen += write((uint8_t)*pStr++); } return nLen; }
+};
+#endif // __cplusplus
+
+#endif // _MOCK_ARDUINO_H_
@@ -0,0 +1,5 @@
+#ifndef _MOCK_FS_H_
+#define _MOCK_FS_H_
+// Host-side mock of the ESP32 FS library (fs::File is provided by SD.h)
+#include "SD.h"
+#endif // _MOCK_FS_H_
@@ -0,0 +1,47 @@
+#ifndef _MOCK_SD_H_
+#define _MOCK_SD_H_
+
+// =======================================================================
+// Host-side mock of the Arduino SD library
+// - Files are read from the host file system
+// - The SD card shares the bus with the display, so any access while
+//   a display transaction is open is an error
+// =======================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+#include "mock_disp.h"
+
+namespace fs {
+
+class File {
+public:
+  File() : m_pFile(NULL) {}
+  operator bool() const { return (m_pFile != NULL); }
+  int read() { mockChkBus(); return fgetc(m_pFile); }
+  int read(void* pBuf,uint16_t nLen) { mockChkBus(); return (int)fread(pBuf,1,nLen,m_pFile); }
+  bool seek(uint32_t nPos) { mockChkBus(); return (fseek(m_pFile,(long)nPos,SEEK_SET) == 0); }
+  uint32_t position() { return (uint32_t)ftell(m_pFile); }
+  void close() { if (m_pFile) { fclose(m_pFile); } m_pFile = NULL; }
+
+  FILE* m_pFile;
+
+private:
+  void mockChkBus() {
+    if (m_sMockStats.bTxOpen) { mock_Fail("SD card access while a display transaction is open"); }
+    m_sMockStats.nSdRead++;
+  }
+};
+
+} // namespace fs
+using fs::File;
+
+class SDClass {
+public:
+  bool begin(int nPinCs) { (void)nPinCs; return true; }
+  template <class T> bool begin(int nPinCs,T& rSpi) { (void)rSpi; return begin(nPinCs); }
+  File open(const char* pFname) { File sFile; sFile.m_pFile = fopen(pFname,"rb"); return sFile; }
+};
+extern SDClass SD;
+
+#endif // _MOCK_SD_H_
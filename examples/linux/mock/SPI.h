@@ -0,0 +1,6 @@
+#ifndef _MOCK_SPI_H_
+#define _MOCK_SPI_H_
+// Host-side mock of the Arduino SPI library
+struct SPIClass {};
+extern SPIClass SPI;
+#endif // _MOCK_SPI_H_
@@ -0,0 +1,273 @@
+#ifndef _MOCK_TFT_ESPI_H_
+#define _MOCK_TFT_ESPI_H_
+
+// =======================================================================
+// Host-side mock of bodmer/TFT_eSPI (including TFT_eSprite)
+// - Records bus transactions and address windows in m_sMockStats
+// - Enforces the transaction rules of the real library:
+//   - startWrite() / endWrite() do not nest (the inner endWrite()
+//     would release the bus of the outer transaction)
+//   - readRect() from the display can't be called while a write
+//     transaction is open
+//   - The drawing APIs may be called inside or outside of a
+//     transaction. Outside of one, each call is its own transaction.
+// - Sprites draw into their own buffer and don't use the bus
+// - The display holds native RGB565 colors. pushImage() and pushRect()
+//   byte-swap the pixels unless setSwapBytes(true) is set, and
+//   readRect() returns the pixels byte-swapped, as on the hardware.
+// - Text only marks a 6x8 cell per character and circles, rounded
+//   rects and filled triangles mark their bounding box
+// =======================================================================
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "gfxfont.h"
+#include "mock_disp.h"
+
+#define TFT_WIDTH           240
+#define TFT_HEIGHT          320
+#define TFT_ESPI_FEATURES   1     // Bit 0 = Viewport capability
+
+#define TFT_BLACK           0x0000
+#define TFT_WHITE           0xFFFF
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+class TFT_eSPI : public Print {
+public:
+  TFT_eSPI(int16_t w=TFT_WIDTH,int16_t h=TFT_HEIGHT)
+    : _init_width(w),_init_height(h),_width(w),_height(h),_img(NULL),_bSprite(false),_swapBytes(false),
+      _textSize(1),_textDatum(TL_DATUM),_textColor(TFT_WHITE),_cursor_x(0),_cursor_y(0)
+  { resetViewport(); }
+  virtual ~TFT_eSPI() {}
+
+  void init() {}
+  SPIClass& getSPIinstance() { return SPI; }
+  void setRotation(uint8_t r) {
+    _width  = (r & 1)? _init_height : _init_width;
+    _height = (r & 1)? _init_width : _init_height;
+    resetViewport();
+  }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  // Transactions
+  void startWrite() {
+    if (m_sMockStats.bTxOpen) { mock_Fail("nested startWrite()"); }
+    m_sMockStats.bTxOpen = true;
+    m_sMockStats.nTx++;
+  }
+  void endWrite() {
+    if (!m_sMockStats.bTxOpen) { mock_Fail("endWrite() without startWrite()"); }
+    m_sMockStats.bTxOpen = false;
+  }
+
+  // Clipping
+  void setViewport(int32_t x,int32_t y,int32_t w,int32_t h,bool bVpDatum=true) {
+    (void)bVpDatum; // Only absolute coordinates are supported
+    _vpX = x; _vpY = y; _vpW = w; _vpH = h;
+  }
+  void resetViewport() { _vpX = 0; _vpY = 0; _vpW = _width; _vpH = _height; }
+
+  // Pixels, lines and rectangles
+  void drawPixel(int32_t x,int32_t y,uint32_t c) {
+    mockWin();
+    if (mockBus()) { m_sMockStats.nWritePixel++; }
+    mockPlot(x,y,(uint16_t)c);
+  }
+  void fillRect(int32_t x,int32_t y,int32_t w,int32_t h,uint32_t c) {
+    mockWin();
+    for (int32_t j=0;j<h;j++) { for (int32_t i=0;i<w;i++) { mockPlot(x+i,y+j,(uint16_t)c); } }
+  }
+  void drawFastHLine(int32_t x,int32_t y,int32_t w,uint32_t c) {
+    if (mockBus()) { m_sMockStats.nWriteHLine++; }
+    fillRect(x,y,w,1,c);
+  }
+  void drawFastVLine(int32_t x,int32_t y,int32_t h,uint32_t c) { fillRect(x,y,1,h,c); }
+  void drawLine(int32_t x0,int32_t y0,int32_t x1,int32_t y1,uint32_t c) {
+    // Bresenham, one address window per pixel
+    int32_t dx = abs(x1-x0), sx = (x0<x1)? 1 : -1;
+    int32_t dy = -abs(y1-y0), sy = (y0<y1)? 1 : -1;
+    int32_t err = dx+dy;
+    while (true) {
+      drawPixel(x0,y0,c);
+      if ((x0 == x1) && (y0 == y1)) { break; }
+      int32_t e2 = 2*err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+  void drawRect(int32_t x,int32_t y,int32_t w,int32_t h,uint32_t c) {
+    drawFastHLine(x,y,w,c); drawFastHLine(x,y+h-1,w,c);
+    drawFastVLine(x,y,h,c); drawFastVLine(x+w-1,y,h,c);
+  }
+  void fillScreen(uint32_t c) { fillRect(0,0,_width,_height,c); }
+
+  // Shapes
+  void drawRoundRect(int32_t x,int32_t y,int32_t w,int32_t h,int32_t r,uint32_t c) { (void)r; drawRect(x,y,w,h,c); }
+  void fillRoundRect(int32_t x,int32_t y,int32_t w,int32_t h,int32_t r,uint32_t c) { (void)r; fillRect(x,y,w,h,c); }
+  void drawCircle(int32_t x,int32_t y,int32_t r,uint32_t c) { drawRect(x-r,y-r,2*r+1,2*r+1,c); }
+  void fillCircle(int32_t x,int32_t y,int32_t r,uint32_t c) { fillRect(x-r,y-r,2*r+1,2*r+1,c); }
+  void drawTriangle(int32_t x0,int32_t y0,int32_t x1,int32_t y1,int32_t x2,int32_t y2,uint32_t c) {
+    drawLine(x0,y0,x1,y1,c); drawLine(x1,y1,x2,y2,c); drawLine(x2,y2,x0,y0,c);
+  }
+  void fillTriangle(int32_t x0,int32_t y0,int32_t x1,int32_t y1,int32_t x2,int32_t y2,uint32_t c) {
+    int32_t nMinX = min3(x0,x1,x2), nMinY = min3(y0,y1,y2);
+    fillRect(nMinX,nMinY,max3(x0,x1,x2)-nMinX+1,max3(y0,y1,y2)-nMinY+1,c);
+  }
+
+  // Images
+  void setSwapBytes(bool bSwap) { _swapBytes = bSwap; }
+  bool getSwapBytes() { return _swapBytes; }
+  void pushImage(int32_t x,int32_t y,int32_t w,int32_t h,const uint16_t* data) {
+    mockWin();
+    for (int32_t j=0;j<h;j++) {
+      for (int32_t i=0;i<w;i++) { mockPlot(x+i,y+j,mockSwap(data[j*w+i])); }
+    }
+  }
+  void pushImage(int32_t x,int32_t y,int32_t w,int32_t h,uint16_t* data) { pushImage(x,y,w,h,(const uint16_t*)data); }
+  void pushImage(int32_t x,int32_t y,int32_t w,int32_t h,const uint16_t* data,uint16_t transp) {
+    mockWin();
+    for (int32_t j=0;j<h;j++) {
+      for (int32_t i=0;i<w;i++) {
+        if (data[j*w+i] != transp) { mockPlot(x+i,y+j,mockSwap(data[j*w+i])); }
+      }
+    }
+  }
+  void pushImage(int32_t x,int32_t y,int32_t w,int32_t h,uint16_t* data,uint16_t transp) {
+    pushImage(x,y,w,h,(const uint16_t*)data,transp);
+  }
+  void pushRect(int32_t x,int32_t y,int32_t w,int32_t h,uint16_t* data) {
+    bool bSwap = _swapBytes;
+    _swapBytes = false;
+    pushImage(x,y,w,h,data);
+    _swapBytes = bSwap;
+  }
+  void readRect(int32_t x,int32_t y,int32_t w,int32_t h,uint16_t* data) {
+    if (mockBus()) {
+      if (m_sMockStats.bTxOpen) { mock_Fail("readRect() while a write transaction is open"); }
+      m_sMockStats.nTx++;
+      m_sMockStats.nRead++;
+    }
+    for (int32_t j=0;j<h;j++) {
+      for (int32_t i=0;i<w;i++) {
+        uint16_t* pPix = mockPix(x+i,y+j);
+        if (pPix == NULL) { mock_Fail("readRect() outside of the target"); }
+        data[j*w+i] = (uint16_t)((*pPix >> 8) | (*pPix << 8));
+      }
+    }
+  }
+  uint16_t color565(uint8_t r,uint8_t g,uint8_t b) { return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)); }
+
+  // Text
+  void setTextColor(uint16_t c) { _textColor = c; }
+  void setTextColor(uint16_t c,uint16_t bg) { (void)bg; _textColor = c; }
+  void setTextFont(uint8_t nFont) { (void)nFont; }
+  void setFreeFont(const GFXfont* pFont) { (void)pFont; }
+  void setTextSize(uint8_t s) { _textSize = (s > 0)? s : 1; }
+  void setTextDatum(uint8_t d) { _textDatum = d; }
+  void setCursor(int16_t x,int16_t y) { _cursor_x = x; _cursor_y = y; }
+  int16_t textWidth(const char* pStr) { return (int16_t)(6*_textSize*strlen(pStr)); }
+  int16_t fontHeight(int16_t nFont) { (void)nFont; return (int16_t)(8*_textSize); }
+  int16_t drawChar(uint16_t ch,int32_t x,int32_t y) {
+    (void)ch;
+    fillRect(x,y,5*_textSize,7*_textSize,_textColor);
+    return (int16_t)(6*_textSize);
+  }
+  int16_t drawString(const char* pStr,int32_t x,int32_t y) {
+    int16_t nW = textWidth(pStr);
+    int16_t nH = fontHeight(1);
+    x -= ((_textDatum % 3) * nW) / 2;
+    y -= ((_textDatum / 3) * nH) / 2;
+    while (*pStr) { x += drawChar((uint8_t)*pStr++,x,y); }
+    return nW;
+  }
+  virtual size_t write(uint8_t ch) {
+    if (ch == '\n') { _cursor_x = 0; _cursor_y += fontHeight(1); return 1; }
+    _cursor_x += drawChar(ch,_cursor_x,_cursor_y);
+    return 1;
+  }
+  size_t println() { return write('\n'); }
+
+protected:
+  // Sprites don't use the bus
+  bool mockBus() const { return !_bSprite; }
+  // Each drawing call outside of a transaction is its own transaction
+  void mockWin() {
+    if (!mockBus()) { return; }
+    if (!m_sMockStats.bTxOpen) { m_sMockStats.nTx++; }
+    m_sMockStats.nWin++;
+  }
+  uint16_t* mockPix(int32_t x,int32_t y) {
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) { return NULL; }
+    if (_bSprite) { return (_img != NULL)? &_img[y*_width+x] : NULL; }
+    if ((x >= MOCK_DISP_W) || (y >= MOCK_DISP_H)) { return NULL; }
+    return &m_anMockFb[y*MOCK_DISP_W+x];
+  }
+  void mockPlot(int32_t x,int32_t y,uint16_t c) {
+    if ((x < _vpX) || (y < _vpY) || (x >= _vpX+_vpW) || (y >= _vpY+_vpH)) { return; }
+    uint16_t* pPix = mockPix(x,y);
+    if (pPix == NULL) { return; }
+    if (mockBus()) { m_sMockStats.nPixels++; }
+    *pPix = c;
+  }
+  uint16_t mockSwap(uint16_t c) const { return (_swapBytes)? c : (uint16_t)((c >> 8) | (c << 8)); }
+  static int32_t min3(int32_t a,int32_t b,int32_t c) { return (a < b)? ((a < c)? a : c) : ((b < c)? b : c); }
+  static int32_t max3(int32_t a,int32_t b,int32_t c) { return (a > b)? ((a > c)? a : c) : ((b > c)? b : c); }
+
+  int16_t   _init_width,_init_height;
+  int16_t   _width,_height;
+  int32_t   _vpX,_vpY,_vpW,_vpH;
+  uint16_t* _img;         // Sprite buffer
+  bool      _bSprite;     // Drawing into a sprite rather than the display
+  bool      _swapBytes;
+  uint8_t   _textSize;
+  uint8_t   _textDatum;
+  uint16_t  _textColor;
+  int16_t   _cursor_x,_cursor_y;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  TFT_eSprite(TFT_eSPI* pTft) : TFT_eSPI(0,0),_tft(pTft) { _bSprite = true; }
+  virtual ~TFT_eSprite() { deleteSprite(); }
+
+  void setColorDepth(int8_t nBits) { (void)nBits; } // Always 16-bit
+  void* createSprite(int16_t w,int16_t h) {
+    deleteSprite();
+    _img = (uint16_t*)calloc((size_t)w*h,sizeof(uint16_t));
+    if (_img == NULL) { return NULL; }
+    _width = w;
+    _height = h;
+    resetViewport();
+    return _img;
+  }
+  void deleteSprite() {
+    free(_img);
+    _img = NULL;
+    _width = 0;
+    _height = 0;
+    resetViewport();
+  }
+  void fillSprite(uint32_t c) { fillRect(0,0,_width,_height,c); }
+  void pushSprite(int32_t x,int32_t y) {
+    // Push the native colors in a single block write
+    bool bSwap = _tft->getSwapBytes();
+    _tft->setSwapBytes(true);
+    _tft->pushImage(x,y,_width,_height,_img);
+    _tft->setSwapBytes(bSwap);
+  }
+
+private:
+  TFT_eSPI* _tft;
+};
+
+#endif // _MOCK_TFT_ESPI_H_
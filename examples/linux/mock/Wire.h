@@ -0,0 +1,4 @@
+#ifndef _MOCK_WIRE_H_
+#define _MOCK_WIRE_H_
+// Host-side mock of the Arduino Wire library (unused)
+#endif // _MOCK_WIRE_H_
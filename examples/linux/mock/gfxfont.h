@@ -0,0 +1,15 @@
+#ifndef _MOCK_GFXFONT_H_
+#define _MOCK_GFXFONT_H_
+// Host-side mock of the Adafruit-GFX font structures
+typedef struct {
+  uint16_t  bitmapOffset;
+  uint8_t   width,height,xAdvance;
+  int8_t    xOffset,yOffset;
+} GFXglyph;
+typedef struct {
+  uint8_t*  bitmap;
+  GFXglyph* glyph;
+  uint16_t  first,last;
+  uint8_t   yAdvance;
+} GFXfont;
+#endif // _MOCK_GFXFONT_H_
@@ -0,0 +1,15 @@
+#ifndef _MOCK_CONFIG_ADAGFX_H_
+#define _MOCK_CONFIG_ADAGFX_H_
+
+// =======================================================================
+// GUIslice config for the Adafruit-GFX host check (check_adagfx_lnx.c)
+// - Uses the Adafruit ILI9341 config with SD card support enabled so
+//   that the SD BMP loader is also checked against the mock
+// =======================================================================
+
+#include "../configs/ard-adagfx-ili9341-notouch.h"
+
+#undef  GSLC_SD_EN
+#define GSLC_SD_EN    1
+
+#endif // _MOCK_CONFIG_ADAGFX_H_
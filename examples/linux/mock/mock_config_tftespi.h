@@ -0,0 +1,15 @@
+#ifndef _MOCK_CONFIG_TFTESPI_H_
+#define _MOCK_CONFIG_TFTESPI_H_
+
+// =======================================================================
+// GUIslice config for the TFT_eSPI host check (check_tftespi_lnx.c)
+// - Uses the default TFT_eSPI config with SD card support enabled so
+//   that the SD BMP loader is also checked against the mock
+// =======================================================================
+
+#include "../configs/esp-tftespi-default-notouch.h"
+
+#undef  GSLC_SD_EN
+#define GSLC_SD_EN    1
+
+#endif // _MOCK_CONFIG_TFTESPI_H_
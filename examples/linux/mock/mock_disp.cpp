@@ -0,0 +1,40 @@
+// =======================================================================
+// Host-side display mock
+// - Storage for the mock display and the Arduino runtime stubs
+// =======================================================================
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <SD.h>
+#include "mock_disp.h"
+
+mock_tsStats  m_sMockStats;
+uint16_t      m_anMockFb[MOCK_DISP_W*MOCK_DISP_H];
+
+SerialStub    Serial;
+SPIClass      SPI;
+SDClass       SD;
+
+extern "C" {
+
+void mock_Reset(void)
+{
+  bool bTxOpen = m_sMockStats.bTxOpen;
+  memset(&m_sMockStats,0,sizeof(m_sMockStats));
+  m_sMockStats.bTxOpen = bTxOpen;
+}
+
+void mock_Fail(const char* pcMsg)
+{
+  fprintf(stderr,"MOCK FAIL: %s\n",pcMsg);
+  abort();
+}
+
+unsigned long millis(void) { return 0; }
+void delay(unsigned long nMs) { (void)nMs; }
+void pinMode(int nPin,int nMode) { (void)nPin; (void)nMode; }
+int  digitalRead(int nPin) { (void)nPin; return 0; }
+void digitalWrite(int nPin,int nVal) { (void)nPin; (void)nVal; }
+int  analogRead(int nPin) { (void)nPin; return 0; }
+
+}
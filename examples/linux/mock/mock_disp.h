@@ -0,0 +1,47 @@
+#ifndef _MOCK_DISP_H_
+#define _MOCK_DISP_H_
+
+// =======================================================================
+// Host-side display mock
+// - Counters and frame buffer shared by the mock display libraries
+//   (Adafruit_GFX.h, TFT_eSPI.h) and the host checks (check_*_lnx.c)
+// - The mock aborts the program if the bus transaction rules of the
+//   real library are broken (see mock_Fail())
+// =======================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define MOCK_DISP_W   320   ///< Width of the mock frame buffer
+#define MOCK_DISP_H   320   ///< Height of the mock frame buffer
+
+/// Bus activity recorded by the mock display
+typedef struct {
+  uint32_t  nTx;          ///< Number of bus transactions (startWrite)
+  uint32_t  nWin;         ///< Number of address windows set
+  uint32_t  nWritePixel;  ///< Number of single pixel writes
+  uint32_t  nWriteHLine;  ///< Number of horizontal runs written
+  uint32_t  nPixels;      ///< Number of pixels written
+  uint32_t  nRead;        ///< Number of display reads (readRect)
+  uint32_t  nSdRead;      ///< Number of SD card reads and seeks
+  bool      bTxOpen;      ///< A bus transaction is currently open
+} mock_tsStats;
+
+extern mock_tsStats m_sMockStats;                     ///< Bus activity since mock_Reset()
+extern uint16_t     m_anMockFb[MOCK_DISP_W*MOCK_DISP_H]; ///< Pixels written to the mock display
+
+/// Clear the statistics (but not the frame buffer)
+void mock_Reset(void);
+
+/// Report a broken bus rule and abort
+void mock_Fail(const char* pcMsg);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // _MOCK_DISP_H_
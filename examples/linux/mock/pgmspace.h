@@ -0,0 +1,5 @@
+#ifndef _MOCK_PGMSPACE_H_
+#define _MOCK_PGMSPACE_H_
+// Host-side mock of pgmspace.h (program memory is ordinary memory)
+#include <Arduino.h>
+#endif // _MOCK_PGMSPACE_H_
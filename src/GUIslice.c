@@ -180,6 +180,38 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->bScreenNeedFlip    = false;
 
   gslc_InvalidateRgnReset(pGui);
+  pGui->bRedrawRgnEn       = false;
+
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  pGui->nTouchGridGen      = 0;
+  #endif
+
+  #if (GSLC_FEATURE_TXT_SZ_CACHE)
+  pGui->nTxtSzGen          = 1;
+  #endif
+
+  #if (GSLC_FEATURE_POLAR_CACHE)
+  pGui->sPolarCache.nStep64 = 0;
+  pGui->sPolarCache.nNumEnt = 0;
+  #endif
+
+  #if (GSLC_FEATURE_SAVE_UNDER)
+  pGui->pSaveBuf           = NULL;
+  pGui->nSaveBufLen        = 0;
+  pGui->bSavePend          = false;
+  pGui->bSaveValid         = false;
+  pGui->bSaveDirty         = false;
+  pGui->bSaveDirtyFull     = false;
+  pGui->nRedrawStack       = GSLC_STACK__MAX;
+  #endif
+
+  #if (GSLC_FEATURE_ELEM_CACHE)
+  pGui->pElemCacheBuf      = NULL;
+  pGui->nElemCacheBufLen   = 0;
+  pGui->nElemCacheBufNext  = 0;
+  pGui->bBkgndColEn        = false;
+  pGui->colBkgnd           = GSLC_COL_BLACK;
+  #endif
 
    // Clear the event-pending struct
   pGui->bEventPending = false;
@@ -817,6 +849,18 @@ bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight)
   }
 }
 
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2)
+{
+  if ((rRect1.w == 0) || (rRect1.h == 0) || (rRect2.w == 0) || (rRect2.h == 0)) {
+    return false;
+  }
+  if ( (rRect1.x + (int16_t)rRect1.w <= rRect2.x) || (rRect2.x + (int16_t)rRect2.w <= rRect1.x) ||
+     (rRect1.y + (int16_t)rRect1.h <= rRect2.y) || (rRect2.y + (int16_t)rRect2.h <= rRect1.y) ) {
+    return false;
+  }
+  return true;
+}
+
 // Ensure the coordinates are increasing from nX0->nX1 and nY0->nY1
 // NOTE: UNUSED
 void gslc_OrderCoord(int16_t* pnX0,int16_t* pnY0,int16_t* pnX1,int16_t* pnY1)
@@ -1029,6 +1073,158 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 }
 
 
+// Read little-endian values from a BMP header
+static uint16_t gslc_BmpRead16(const uint8_t* pBuf)
+{
+  return (uint16_t)(pBuf[0] | (pBuf[1] << 8));
+}
+
+static uint32_t gslc_BmpRead32(const uint8_t* pBuf)
+{
+  return (uint32_t)pBuf[0] | ((uint32_t)pBuf[1] << 8) |
+    ((uint32_t)pBuf[2] << 16) | ((uint32_t)pBuf[3] << 24);
+}
+
+bool gslc_BmpStreamOpen(gslc_tsBmpStream* pStream,void* pvFile,GSLC_CB_FILE_READ pfuncRead,
+  GSLC_CB_FILE_SEEK pfuncSeek,uint8_t* pBuf,uint16_t nBufLen)
+{
+  pStream->pvFile    = pvFile;
+  pStream->pfuncRead = pfuncRead;
+  pStream->pfuncSeek = pfuncSeek;
+  pStream->pBuf      = pBuf;
+  pStream->nBufLen   = nBufLen;
+  pStream->nFilePos  = 0;
+  pStream->nBufRows  = 0;
+
+  // Parse the file and DIB headers
+  if ((nBufLen < 54) || ((*pfuncRead)(pvFile,pBuf,54) != 54) ||
+      (pBuf[0] != 'B') || (pBuf[1] != 'M')) {
+    return false;
+  }
+  pStream->nFilePos  = 54;
+  int32_t  nBmpW     = (int32_t)gslc_BmpRead32(&pBuf[18]);
+  int32_t  nBmpH     = (int32_t)gslc_BmpRead32(&pBuf[22]);
+  uint16_t nPlanes   = gslc_BmpRead16(&pBuf[26]);
+  uint16_t nBpp      = gslc_BmpRead16(&pBuf[28]);
+  uint32_t nCompress = gslc_BmpRead32(&pBuf[30]);
+
+  // If the height is negative, the image is stored top-to-bottom
+  pStream->bFlip = true;
+  if (nBmpH < 0) {
+    nBmpH = -nBmpH;
+    pStream->bFlip = false;
+  }
+  if ((nPlanes != 1) || ((nBpp != 24) && (nBpp != 32)) || (nCompress != 0) ||
+      (nBmpW <= 0) || (nBmpW > 32767) || (nBmpH <= 0) || (nBmpH > 32767)) {
+    return false;
+  }
+  pStream->nImgW     = (int16_t)nBmpW;
+  pStream->nImgH     = (int16_t)nBmpH;
+  pStream->nPixBytes = nBpp / 8;
+  pStream->nDataPos  = gslc_BmpRead32(&pBuf[10]);
+  // BMP rows are padded to a 4-byte boundary
+  pStream->nRowSize  = ((uint32_t)nBmpW * pStream->nPixBytes + 3) & ~3UL;
+
+  return gslc_BmpStreamSetRegion(pStream,(gslc_tsRect){0,0,(uint16_t)nBmpW,(uint16_t)nBmpH});
+}
+
+bool gslc_BmpStreamSetRegion(gslc_tsBmpStream* pStream,gslc_tsRect rRegion)
+{
+  gslc_tsRect rImg = (gslc_tsRect){0,0,(uint16_t)pStream->nImgW,(uint16_t)pStream->nImgH};
+  if (!gslc_ClipRect(&rImg,&rRegion)) {
+    rRegion.h = 0;
+  }
+  pStream->rRegion  = rRegion;
+  pStream->nRow     = rRegion.y;
+  pStream->nCol     = rRegion.x;
+  pStream->nBufRows = 0;
+  return (rRegion.h > 0);
+}
+
+// Fill the stream buffer from a position in the file
+// - A seek is only performed if the data doesn't follow the previous read
+static bool gslc_BmpStreamFill(gslc_tsBmpStream* pStream,uint32_t nPos,uint16_t nLen)
+{
+  if (nPos != pStream->nFilePos) {
+    if (!(*pStream->pfuncSeek)(pStream->pvFile,nPos)) {
+      GSLC_DEBUG2_PRINT("ERROR: BmpStreamFill() seek to %lu failed\n",(unsigned long)nPos);
+      return false;
+    }
+  }
+  if ((*pStream->pfuncRead)(pStream->pvFile,pStream->pBuf,nLen) != (int32_t)nLen) {
+    GSLC_DEBUG2_PRINT("ERROR: BmpStreamFill() read at %lu failed\n",(unsigned long)nPos);
+    pStream->nFilePos = 0xFFFFFFFF;
+    return false;
+  }
+  pStream->nFilePos = nPos + nLen;
+  return true;
+}
+
+uint16_t gslc_BmpStreamRead(gslc_tsBmpStream* pStream,int16_t* pnX,int16_t* pnY,const uint8_t** ppPix)
+{
+  int16_t   nRow      = pStream->nRow;
+  int16_t   nRowEnd   = pStream->rRegion.y + pStream->rRegion.h;
+  int16_t   nColEnd   = pStream->rRegion.x + pStream->rRegion.w;
+  uint32_t  nRowSize  = pStream->nRowSize;
+  uint32_t  nRowsFit  = pStream->nBufLen / nRowSize;
+  uint16_t  nCnt;
+  int16_t   nFileRow;
+
+  if (nRow >= nRowEnd) {
+    return 0;
+  }
+
+  if (nRowsFit > 0) {
+    // Whole rows fit in the buffer
+    if ((pStream->nBufRows == 0) || (nRow >= pStream->nBufRow0 + pStream->nBufRows)) {
+      // Read ahead as many rows as the buffer holds
+      int16_t nRows = nRowEnd - nRow;
+      if (nRows > (int16_t)nRowsFit) {
+        nRows = (int16_t)nRowsFit;
+      }
+      // A group of bottom-to-top rows is still contiguous in the
+      // file, so it only needs a single read
+      nFileRow = (pStream->bFlip)? (pStream->nImgH - nRow - nRows) : nRow;
+      if (!gslc_BmpStreamFill(pStream,pStream->nDataPos + nFileRow * nRowSize,(uint16_t)(nRows * nRowSize))) {
+        pStream->nRow = nRowEnd;
+        return 0;
+      }
+      pStream->nBufRow0 = nRow;
+      pStream->nBufRows = nRows;
+    }
+    int16_t nBufInd = nRow - pStream->nBufRow0;
+    if (pStream->bFlip) {
+      nBufInd = pStream->nBufRows - 1 - nBufInd;
+    }
+    *ppPix = pStream->pBuf + nBufInd * nRowSize + pStream->rRegion.x * pStream->nPixBytes;
+    *pnX   = pStream->rRegion.x;
+    nCnt   = pStream->rRegion.w;
+    pStream->nRow++;
+  } else {
+    // Rows are larger than the buffer so read them in pieces
+    uint16_t nMaxCnt = pStream->nBufLen / pStream->nPixBytes;
+    nCnt = nColEnd - pStream->nCol;
+    if (nCnt > nMaxCnt) {
+      nCnt = nMaxCnt;
+    }
+    nFileRow = (pStream->bFlip)? (pStream->nImgH - 1 - nRow) : nRow;
+    if (!gslc_BmpStreamFill(pStream,pStream->nDataPos + nFileRow * nRowSize + pStream->nCol * pStream->nPixBytes,
+        nCnt * pStream->nPixBytes)) {
+      pStream->nRow = nRowEnd;
+      return 0;
+    }
+    *ppPix = pStream->pBuf;
+    *pnX   = pStream->nCol;
+    pStream->nCol += nCnt;
+    if (pStream->nCol >= nColEnd) {
+      pStream->nCol = pStream->rRegion.x;
+      pStream->nRow++;
+    }
+  }
+  *pnY = nRow;
+  return nCnt;
+}
+
 // Sine function with optional lookup table
 // - Note that the n64Ang range is limited by 16-bit integers
 //   to an effective degree range of -511 to +511 degrees,
@@ -1143,6 +1339,79 @@ void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY)
   *nDY = nTmp / 32767;
 }
 
+void gslc_PolarCacheAdd(gslc_tsGui* pGui,int16_t nStep64)
+{
+#if (GSLC_FEATURE_POLAR_CACHE)
+  gslc_tsPolarCache* pCache = &(pGui->sPolarCache);
+  int16_t  nStepNew,nTmp,nRem;
+  uint16_t nNumEnt,nInd;
+
+  if (nStep64 <= 0) {
+    return;
+  }
+  // Already covered by the existing table?
+  if ((pCache->nStep64 != 0) && (nStep64 % pCache->nStep64 == 0)) {
+    return;
+  }
+
+  // Combine with the existing step (greatest common divisor)
+  nStepNew = nStep64;
+  nTmp = pCache->nStep64;
+  while (nTmp != 0) {
+    nRem = nStepNew % nTmp;
+    nStepNew = nTmp;
+    nTmp = nRem;
+  }
+  nNumEnt = (uint16_t)(((int32_t)360*64 + nStepNew - 1) / nStepNew);
+  if (nNumEnt > GSLC_POLAR_CACHE_MAX) {
+    // Too fine to cache, so keep the existing table
+    return;
+  }
+
+  for (nInd=0;nInd<nNumEnt;nInd++) {
+    pCache->anSin[nInd] = gslc_sinFX((int16_t)(nInd*nStepNew));
+    pCache->anCos[nInd] = gslc_cosFX((int16_t)(nInd*nStepNew));
+  }
+  pCache->nStep64 = nStepNew;
+  pCache->nNumEnt = nNumEnt;
+#else
+  (void)pGui; // Unused
+  (void)nStep64; // Unused
+#endif
+}
+
+void gslc_PolarSinCos(gslc_tsGui* pGui,int32_t n64Ang,int16_t* pnSin,int16_t* pnCos)
+{
+  // Normalize the angle to a single rotation
+  int32_t n64AngNorm = ((n64Ang % (360*64)) + (360*64)) % (360*64);
+
+#if (GSLC_FEATURE_POLAR_CACHE)
+  gslc_tsPolarCache* pCache = &(pGui->sPolarCache);
+  if ((pCache->nStep64 != 0) && (n64AngNorm % pCache->nStep64 == 0)) {
+    *pnSin = pCache->anSin[n64AngNorm / pCache->nStep64];
+    *pnCos = pCache->anCos[n64AngNorm / pCache->nStep64];
+    return;
+  }
+#else
+  (void)pGui; // Unused
+#endif
+  // Pass the angle through unchanged where possible so that the
+  // result matches a direct call to gslc_sinFX() / gslc_cosFX()
+  if ((n64Ang < -360*64) || (n64Ang >= 360*64)) {
+    n64Ang = n64AngNorm;
+  }
+  *pnSin = gslc_sinFX((int16_t)n64Ang);
+  *pnCos = gslc_cosFX((int16_t)n64Ang);
+}
+
+void gslc_PolarToXYCache(gslc_tsGui* pGui,uint16_t nRad,int32_t n64Ang,int16_t* nDX,int16_t* nDY)
+{
+  int16_t nSin,nCos;
+  gslc_PolarSinCos(pGui,n64Ang,&nSin,&nCos);
+  *nDX = (int32_t)nRad *  nSin / 32767;
+  *nDY = (int32_t)nRad * -nCos / 32767;
+}
+
 // Call with nMidAmt=500 to create simple linear blend between two colors
 gslc_tsColor gslc_ColorBlend2(gslc_tsColor colStart,gslc_tsColor colEnd,uint16_t nMidAmt,uint16_t nBlendAmt)
 {
@@ -1258,6 +1527,55 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
 }
 
 
+void gslc_DrawPolyline(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  if (nNumPt == 0) {
+    return;
+  } else if (nNumPt == 1) {
+    gslc_DrawSetPixel(pGui,asPt[0].x,asPt[0].y,nCol);
+    return;
+  }
+
+#if (DRV_HAS_DRAW_LINES)
+  // Call optimized driver polyline drawing
+  gslc_DrvDrawLines(pGui,asPt,nNumPt,nCol);
+#else
+  // Draw each segment separately
+  uint16_t nIndPt;
+  for (nIndPt=1;nIndPt<nNumPt;nIndPt++) {
+    gslc_DrawLine(pGui,asPt[nIndPt-1].x,asPt[nIndPt-1].y,asPt[nIndPt].x,asPt[nIndPt].y,nCol);
+  }
+#endif
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+void gslc_DrawFillSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol)
+{
+  if (nNumSpan == 0) {
+    return;
+  }
+
+#if (DRV_HAS_DRAW_SPANS)
+  // Call optimized driver span filling
+  gslc_DrvDrawSpans(pGui,asSpan,nNumSpan,nCol);
+#else
+  // Fill each span separately
+  uint16_t nIndSpan;
+  for (nIndSpan=0;nIndSpan<nNumSpan;nIndSpan++) {
+  #if (DRV_HAS_DRAW_RECT_FILL)
+    gslc_DrvDrawFillRect(pGui,(gslc_tsRect){asSpan[nIndSpan].x0,asSpan[nIndSpan].y,
+      asSpan[nIndSpan].x1-asSpan[nIndSpan].x0+1,1},nCol);
+  #else
+    gslc_DrawLine(pGui,asSpan[nIndSpan].x0,asSpan[nIndSpan].y,asSpan[nIndSpan].x1,asSpan[nIndSpan].y,nCol);
+  #endif
+  }
+#endif
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+
 void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_tsColor nCol)
 {
   uint16_t nOffset;
@@ -1283,10 +1601,12 @@ void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_ts
 void gslc_DrawLinePolar(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nRadStart,uint16_t nRadEnd,int16_t n64Ang,gslc_tsColor nCol)
 {
   // Draw the ray representing the current value
-  int16_t nDxS = (int32_t)nRadStart * gslc_sinFX(n64Ang)/32768;
-  int16_t nDyS = (int32_t)nRadStart * gslc_cosFX(n64Ang)/32768;
-  int16_t nDxE = (int32_t)nRadEnd   * gslc_sinFX(n64Ang)/32768;
-  int16_t nDyE = (int32_t)nRadEnd   * gslc_cosFX(n64Ang)/32768;
+  int16_t nSin,nCos;
+  gslc_PolarSinCos(pGui,n64Ang,&nSin,&nCos);
+  int16_t nDxS = (int32_t)nRadStart * nSin/32768;
+  int16_t nDyS = (int32_t)nRadStart * nCos/32768;
+  int16_t nDxE = (int32_t)nRadEnd   * nSin/32768;
+  int16_t nDyE = (int32_t)nRadEnd   * nCos/32768;
   gslc_DrawLine(pGui,nX+nDxS,nY-nDyS,nX+nDxE,nY-nDyE,nCol);
 }
 
@@ -1455,7 +1775,7 @@ void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
   GSLC_DEBUG_PRINT("DBG: InvRgnReset\n", "");
 #endif
   pGui->bInvalidateEn = false;
-  pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, 1, 1 };
+  pGui->nInvalidateRectCnt = 0;
 }
 
 void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
@@ -1464,7 +1784,8 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
   GSLC_DEBUG_PRINT("DBG: InvRgnScreen\n", "");
 #endif
   pGui->bInvalidateEn = true;
-  pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  pGui->nInvalidateRectCnt = 1;
+  pGui->asInvalidateRect[0] = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
 }
 
 void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
@@ -1478,18 +1799,64 @@ void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
     pPage->rBounds.x, pPage->rBounds.y, pPage->rBounds.x + pPage->rBounds.w - 1, pPage->rBounds.y + pPage->rBounds.h - 1); //xxx
 #endif // DBG_REDRAW
   gslc_InvalidateRgnAdd(pGui, pPage->rBounds);
-  pGui->bInvalidateEn = true;
 }
 
 
+// Calculate the number of pixels in a rect
+static uint32_t gslc_RectArea(gslc_tsRect rRect)
+{
+  return (uint32_t)rRect.w * rRect.h;
+}
+
 void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect)
 {
-  if (pGui->bInvalidateEn) {
-    gslc_UnionRect(&(pGui->rInvalidateRect), rAddRect);
+  gslc_tsRect*  asRect = pGui->asInvalidateRect;
+  gslc_tsRect   rUnion;
+  uint8_t       nInd;
+
+  // An empty rect doesn't invalidate anything
+  if ((rAddRect.w == 0) || (rAddRect.h == 0)) {
+    return;
+  }
+
+  // Merge the new rect with any existing region where the
+  // merged rect is no larger than the two rects drawn separately.
+  // As the merged rect may now qualify to absorb other regions,
+  // restart the scan after each merge.
+  nInd = 0;
+  while (nInd < pGui->nInvalidateRectCnt) {
+    rUnion = asRect[nInd];
+    gslc_UnionRect(&rUnion, rAddRect);
+    if (gslc_RectArea(rUnion) <= gslc_RectArea(asRect[nInd]) + gslc_RectArea(rAddRect)) {
+      rAddRect = rUnion;
+      // Remove the absorbed region by moving the last one into its place
+      pGui->nInvalidateRectCnt--;
+      asRect[nInd] = asRect[pGui->nInvalidateRectCnt];
+      nInd = 0;
+    } else {
+      nInd++;
+    }
+  }
+
+  if (pGui->nInvalidateRectCnt < GSLC_INVALIDATE_RGN_MAX) {
+    pGui->abInvalidateRectFull[pGui->nInvalidateRectCnt] = false;
+    asRect[pGui->nInvalidateRectCnt++] = rAddRect;
   } else {
-    pGui->bInvalidateEn = true;
-    pGui->rInvalidateRect = rAddRect;
+    // No space left, so merge with the region that grows the least
+    uint8_t   nIndBest = 0;
+    uint32_t  nGrowBest = 0;
+    for (nInd = 0; nInd < pGui->nInvalidateRectCnt; nInd++) {
+      rUnion = asRect[nInd];
+      gslc_UnionRect(&rUnion, rAddRect);
+      uint32_t nGrow = gslc_RectArea(rUnion) - gslc_RectArea(asRect[nInd]);
+      if ((nInd == 0) || (nGrow < nGrowBest)) {
+        nIndBest = nInd;
+        nGrowBest = nGrow;
+      }
+    }
+    gslc_UnionRect(&(asRect[nIndBest]), rAddRect);
   }
+  pGui->bInvalidateEn = true;
 }
 
 
@@ -1574,33 +1941,28 @@ void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
     // Call optimized driver implementation
     gslc_DrvDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol);
   #else
-    // Emulate circle with line drawing
+    // Emulate circle with horizontal spans
 
     int16_t nX    = nRadius;  // a
     int16_t nY    = 0;        // b
     int16_t nErr  = 0;
 
+    gslc_tsSpan asSpan[GSLC_SPAN_BATCH];
+    uint16_t    nSpanCnt = 0;
+
     while (nX >= nY)
     {
 
       // Connect pairs of the reflected points around the circumference
-
-      //gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY + nX,nCol);  // (-b,+a)
-      //gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY + nX,nCol);  // (+b,+a)
-      gslc_DrawLine(pGui,nMidX-nY,nMidY+nX,nMidX+nY,nMidY+nX,nCol);
-
-      //gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY + nY,nCol);  // (-a,+b)
-      //gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY + nY,nCol);  // (+a,+b)
-      gslc_DrawLine(pGui,nMidX-nX,nMidY+nY,nMidX+nX,nMidY+nY,nCol);
-
-      //gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY - nY,nCol);  // (-a,-b)
-      //gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY - nY,nCol);  // (+a,-b)
-      gslc_DrawLine(pGui,nMidX-nX,nMidY-nY,nMidX+nX,nMidY-nY,nCol);
-
-      //gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY - nX,nCol);  // (-b,-a)
-      //gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY - nX,nCol);  // (+b,-a)
-      gslc_DrawLine(pGui,nMidX-nY,nMidY-nX,nMidX+nY,nMidY-nX,nCol);
-
+      // - Rows (+a), (+b), (-b), (-a)
+      asSpan[nSpanCnt++] = (gslc_tsSpan){(int16_t)(nMidY+nX),(int16_t)(nMidX-nY),(int16_t)(nMidX+nY)};
+      asSpan[nSpanCnt++] = (gslc_tsSpan){(int16_t)(nMidY+nY),(int16_t)(nMidX-nX),(int16_t)(nMidX+nX)};
+      asSpan[nSpanCnt++] = (gslc_tsSpan){(int16_t)(nMidY-nY),(int16_t)(nMidX-nX),(int16_t)(nMidX+nX)};
+      asSpan[nSpanCnt++] = (gslc_tsSpan){(int16_t)(nMidY-nX),(int16_t)(nMidX-nY),(int16_t)(nMidX+nY)};
+      if (nSpanCnt > GSLC_SPAN_BATCH-4) {
+        gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
+        nSpanCnt = 0;
+      }
 
       nY    += 1;
       nErr  += 1 + 2*nY;
@@ -1611,6 +1973,7 @@ void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
       }
     } // while
 
+    gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
 
   #endif
 
@@ -1649,6 +2012,64 @@ void gslc_SwapCoords(int16_t* pnXa,int16_t* pnYa,int16_t* pnXb,int16_t* pnYb)
 }
 
 
+#if !(DRV_HAS_DRAW_TRI_FILL)
+// Incremental edge stepper used by the triangle fill
+// - Tracks X = X0 + round(t*nDX/nDY) while the row offset t
+//   changes by one for each row, using only additions
+// - t must not change sign over the rows being stepped
+typedef struct {
+  int16_t   nX0;      // X coordinate of the edge origin
+  int8_t    nSign;    // Sign of the X offset from the origin
+  int8_t    nDir;     // Change in |t| for each row (+1 or -1)
+  int32_t   nQ;       // Magnitude of the X offset
+  int32_t   nR;       // Remainder of the X offset
+  int32_t   nDiv;     // Divisor (2*|nDY|)
+  int32_t   nStepQ;   // Change in quotient for each row
+  int32_t   nStepR;   // Change in remainder for each row
+} gslc_tsTriEdge;
+
+static void gslc_TriEdgeInit(gslc_tsTriEdge* pEdge,int16_t nX0,int16_t nDX,int16_t nDY,int16_t nT)
+{
+  int32_t nAbsDX = (nDX < 0)? -(int32_t)nDX : nDX;
+  int32_t nAbsDY = (nDY < 0)? -(int32_t)nDY : nDY;
+  int32_t nAbsT  = (nT  < 0)? -(int32_t)nT  : nT;
+  int32_t nNum;
+
+  // Rows advance towards the origin when t is negative
+  pEdge->nX0    = nX0;
+  pEdge->nDir   = (nT < 0)? -1 : 1;
+  pEdge->nSign  = pEdge->nDir;
+  if (nDX < 0) { pEdge->nSign = -pEdge->nSign; }
+  if (nDY < 0) { pEdge->nSign = -pEdge->nSign; }
+
+  // |X offset| = floor((2*|t*nDX| + |nDY|) / (2*|nDY|))
+  pEdge->nDiv   = 2*nAbsDY;
+  nNum          = 2*nAbsT*nAbsDX + nAbsDY;
+  pEdge->nQ     = nNum / pEdge->nDiv;
+  pEdge->nR     = nNum % pEdge->nDiv;
+  pEdge->nStepQ = (2*nAbsDX) / pEdge->nDiv;
+  pEdge->nStepR = (2*nAbsDX) % pEdge->nDiv;
+}
+
+static int16_t gslc_TriEdgeX(gslc_tsTriEdge* pEdge)
+{
+  return (int16_t)(pEdge->nX0 + pEdge->nSign*pEdge->nQ);
+}
+
+static void gslc_TriEdgeStep(gslc_tsTriEdge* pEdge)
+{
+  if (pEdge->nDir > 0) {
+    pEdge->nQ += pEdge->nStepQ;
+    pEdge->nR += pEdge->nStepR;
+    if (pEdge->nR >= pEdge->nDiv) { pEdge->nR -= pEdge->nDiv; pEdge->nQ++; }
+  } else {
+    pEdge->nQ -= pEdge->nStepQ;
+    pEdge->nR -= pEdge->nStepR;
+    if (pEdge->nR < 0) { pEdge->nR += pEdge->nDiv; pEdge->nQ--; }
+  }
+}
+#endif // DRV_HAS_DRAW_TRI_FILL
+
 // Draw a filled triangle
 void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
     int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
@@ -1680,57 +2101,51 @@ void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
     if (nY1>nY0) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
     if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
 
-    // TODO: It is more efficient to calculate row endpoints
-    // using incremental additions instead of multiplies/divides
-
-    int16_t nXa,nXb,nXc,nYos;
-    int16_t nX01,nX20,nY01,nY20,nX21,nY21;
-    nX01 = nX0-nX1; nY01 = nY0-nY1;
-    nX20 = nX2-nX0; nY20 = nY2-nY0;
-    nX21 = nX2-nX1; nY21 = nY2-nY1;
-
-    // Flat bottom scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY0 == nY1 or nY2
-    for (nYos=0;nYos<nY01;nYos++) {
-      // Determine row endpoints (no rounding)
-      //nXa = (nYos          )*(nX0-nX1)/(nY0-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
-
-      // Determine row endpoints (using rounding)
-      nXa  = 2*(nYos)*nX01;
-      nXa += (nXa>=0)?abs(nY01):-abs(nY01);
-      nXa /= 2*nY01;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
-
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXa,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
+    // Each row endpoint is X = round(t*dX/dY) along an edge,
+    // where t is the row offset from the edge origin. These
+    // are calculated incrementally by gslc_TriEdgeStep() and
+    // round identically to the division (halves away from zero)
+    // so that the seam between the two triangles of a quad
+    // is still covered.
+    // - Edge B runs from vertex 0 to vertex 2 for all rows
+    // - Edge C runs from vertex 1 to vertex 2 (flat top rows)
+    // - Edge A runs from vertex 1 to vertex 0 (flat bottom rows)
+    // - Rows are drawn from nY2 up to (but excluding) nY0
+    if (nY0 == nY2) {
+      gslc_PageFlipSet(pGui,true);
+      return;
     }
 
-    // Flat top scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY2 == nY0 or nY1
-    for (nYos=nY21;nYos<0;nYos++) {
-
-      // Determine row endpoints (no rounding)
-      //nXc = (nYos          )*(nX2-nX1)/(nY2-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
+    gslc_tsTriEdge  sEdgeA,sEdgeB,sEdgeC;
+    gslc_tsTriEdge* pEdgeSide;
+    gslc_tsSpan     asSpan[GSLC_SPAN_BATCH];
+    uint16_t        nSpanCnt = 0;
+    int16_t         nY,nXs,nXb;
 
-      // Determine row endpoints (using rounding)
-      nXc  = 2*(nYos)*nX21;
-      nXc += (nXc>=0)?abs(nY21):-abs(nY21);
-      nXc /= 2*nY21;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
+    gslc_TriEdgeInit(&sEdgeB,nX0,nX2-nX0,nY2-nY0,nY2-nY0);
+    if (nY1 != nY2) {
+      gslc_TriEdgeInit(&sEdgeC,nX1,nX2-nX1,nY2-nY1,nY2-nY1);
+    }
+    if (nY0 != nY1) {
+      gslc_TriEdgeInit(&sEdgeA,nX1,nX0-nX1,nY0-nY1,0);
+    }
 
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXc,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
+    for (nY=nY2;nY<nY0;nY++) {
+      pEdgeSide = (nY < nY1)? &sEdgeC : &sEdgeA;
+      nXs = gslc_TriEdgeX(pEdgeSide);
+      nXb = gslc_TriEdgeX(&sEdgeB);
+      asSpan[nSpanCnt].y  = nY;
+      asSpan[nSpanCnt].x0 = (nXs < nXb)? nXs : nXb;
+      asSpan[nSpanCnt].x1 = (nXs < nXb)? nXb : nXs;
+      nSpanCnt++;
+      if (nSpanCnt == GSLC_SPAN_BATCH) {
+        gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
+        nSpanCnt = 0;
+      }
+      gslc_TriEdgeStep(pEdgeSide);
+      gslc_TriEdgeStep(&sEdgeB);
     }
+    gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
 
   #endif  // DRV_HAS_DRAW_TRI_FILL
 
@@ -1739,20 +2154,14 @@ void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
 void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 {
-  int16_t nX0,nY0,nX1,nY1;
-
-  nX0 = psPt[0].x; nY0 = psPt[0].y; nX1 = psPt[1].x; nY1 = psPt[1].y;
-  gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
-
-  nX0 = psPt[1].x; nY0 = psPt[1].y; nX1 = psPt[2].x; nY1 = psPt[2].y;
-  gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
-
-  nX0 = psPt[2].x; nY0 = psPt[2].y; nX1 = psPt[3].x; nY1 = psPt[3].y;
-  gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
-
-  nX0 = psPt[3].x; nY0 = psPt[3].y; nX1 = psPt[0].x; nY1 = psPt[0].y;
-  gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
-
+  // Close the shape by returning to the first point
+  gslc_tsPt asPt[5];
+  asPt[0] = psPt[0];
+  asPt[1] = psPt[1];
+  asPt[2] = psPt[2];
+  asPt[3] = psPt[3];
+  asPt[4] = psPt[0];
+  gslc_DrawPolyline(pGui,asPt,5,nCol);
 }
 
 // Filling a quadrilateral is done by breaking it down into
@@ -1776,76 +2185,209 @@ void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 
 }
 
+// Restrict the integer range [*pnLo,*pnHi] to the values of x
+// that satisfy (nK*x + nM >= 0)
+static void gslc_SectorClipHalf(int32_t nK,int32_t nM,int32_t* pnLo,int32_t* pnHi)
+{
+  int32_t nQ;
+  if (nK > 0) {
+    // x >= ceil(-nM/nK)
+    nQ = (nM <= 0)? (-nM + nK - 1) / nK : -(nM / nK);
+    if (nQ > *pnLo) { *pnLo = nQ; }
+  } else if (nK < 0) {
+    // x <= floor(nM/-nK)
+    nQ = (nM >= 0)? nM / -nK : -((-nM - nK - 1) / -nK);
+    if (nQ < *pnHi) { *pnHi = nQ; }
+  } else if (nM < 0) {
+    // No solutions
+    *pnLo = 1;
+    *pnHi = 0;
+  }
+}
+
+// Find floor(sqrt(nVal)), starting the search from a nearby
+// value (eg. the result for the previous row)
+static int32_t gslc_SectorSqrt(int32_t nVal,int32_t nGuess)
+{
+  int32_t nX = (nGuess < 0)? 0 : nGuess;
+  if (nVal <= 0) { return 0; }
+  while (nX*nX > nVal) { nX--; }
+  while ((nX+1)*(nX+1) <= nVal) { nX++; }
+  return nX;
+}
+
+// Fill the region of an annulus between angles nAng64 (inclusive)
+// and nAng64+nSpan64 (exclusive), measured clockwise from the top
+// - nSpan64 must be no more than 90 degrees so that the region is
+//   the intersection of two half-planes with the annulus
+// - A pixel belongs to the region if its center lies within it,
+//   so regions that share an angle are exact complements
+// - The midpoint is taken as the corner between four pixels so that
+//   an outer radius of nRadOut covers 2*nRadOut pixels. In units of
+//   half a pixel, the center of pixel (nDX,nDY) is at (2*nDX+1,2*nDY+1)
+static void gslc_DrawFillSectorWedge(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,int16_t nRadIn,int16_t nRadOut,
+  int32_t nAng64,int32_t nSpan64,gslc_tsColor nCol)
+{
+  gslc_tsSpan asSpan[GSLC_SPAN_BATCH];
+  uint16_t    nSpanCnt = 0;
+
+  // Direction of each boundary ray is (sin,-cos)
+  nAng64 = ((nAng64 % (360*64)) + (360*64)) % (360*64);
+  int16_t nSinFX,nCosFX;
+  gslc_PolarSinCos(pGui,nAng64,&nSinFX,&nCosFX);
+  int32_t nSinA = nSinFX;
+  int32_t nCosA = nCosFX;
+  gslc_PolarSinCos(pGui,nAng64+nSpan64,&nSinFX,&nCosFX);
+  int32_t nSinB = nSinFX;
+  int32_t nCosB = nCosFX;
+  bool    bUp   = (((360*64) - nAng64) % (360*64) < nSpan64);
+  bool    bDown = ((((180*64) - nAng64) + (360*64)) % (360*64) < nSpan64);
+
+  // Determine the range of rows from the corners and any
+  // vertical extremes of the outer arc
+  int32_t nRowMin,nRowMax,nRowCorner;
+  nRowMin = nRowMax = 0;
+  nRowCorner = -(int32_t)nRadOut * nCosA / 32767;
+  if (nRowCorner < nRowMin) { nRowMin = nRowCorner; }
+  if (nRowCorner > nRowMax) { nRowMax = nRowCorner; }
+  nRowCorner = -(int32_t)nRadOut * nCosB / 32767;
+  if (nRowCorner < nRowMin) { nRowMin = nRowCorner; }
+  if (nRowCorner > nRowMax) { nRowMax = nRowCorner; }
+  if (nRadIn > 0) {
+    // The inner corners bound the region when it doesn't reach the center
+    int32_t nRowInA = -(int32_t)nRadIn * nCosA / 32767;
+    int32_t nRowInB = -(int32_t)nRadIn * nCosB / 32767;
+    if ((nRowInA > 0) && (nRowInB > 0)) { nRowMin = (nRowInA < nRowInB)? nRowInA : nRowInB; }
+    if ((nRowInA < 0) && (nRowInB < 0)) { nRowMax = (nRowInA > nRowInB)? nRowInA : nRowInB; }
+  }
+  nRowMin = (bUp)? -nRadOut : nRowMin-1;
+  nRowMax = (bDown)? nRadOut-1 : nRowMax+1;
+  if (nRowMin < -nRadOut) { nRowMin = -nRadOut; }
+  if (nRowMax > nRadOut-1) { nRowMax = nRadOut-1; }
+  if (nRowMin < -nMidY) { nRowMin = -nMidY; }
+  if (nRowMax > (int32_t)pGui->nDispH-1-nMidY) { nRowMax = (int32_t)pGui->nDispH-1-nMidY; }
+
+  int32_t nRadOut4 = 4*(int32_t)nRadOut*nRadOut;
+  int32_t nRadIn4  = 4*(int32_t)nRadIn*nRadIn;
+  int32_t nOut = 0;
+  int32_t nIn = 0;
+  int32_t nDY,nDY2,nLo,nHi,nInHi,nL,nR;
+
+  for (nDY=nRowMin;nDY<=nRowMax;nDY++) {
+    nDY2 = 2*nDY+1;
+
+    // Span of the outer circle: |2*nDX+1| <= nOut
+    nOut = gslc_SectorSqrt(nRadOut4 - nDY2*nDY2,nOut);
+    nHi = (nOut > 0)? (nOut-1) / 2 : -1;
+    nLo = -1 - nHi;
+
+    // Clockwise of the start ray (inclusive) and
+    // anticlockwise of the end ray (exclusive)
+    gslc_SectorClipHalf(2*nCosA,nCosA+nSinA*nDY2,&nLo,&nHi);
+    gslc_SectorClipHalf(-2*nCosB,-nCosB-nSinB*nDY2-1,&nLo,&nHi);
+    // Limit the span to the display columns
+    if (nLo < -nMidX) { nLo = -nMidX; }
+    if (nHi > (int32_t)pGui->nDispW-1-nMidX) { nHi = (int32_t)pGui->nDispW-1-nMidX; }
+    if (nLo > nHi) {
+      continue;
+    }
+
+    // Remove the span of the inner circle: |2*nDX+1| <= nIn
+    // - nIn is the largest value with nIn*nIn < nRadIn4 - nDY2*nDY2
+    nIn = (nRadIn4 - nDY2*nDY2 > 0)? gslc_SectorSqrt(nRadIn4 - nDY2*nDY2 - 1,nIn) : 0;
+    if (nIn == 0) {
+      asSpan[nSpanCnt++] = (gslc_tsSpan){(int16_t)(nMidY+nDY),(int16_t)(nMidX+nLo),(int16_t)(nMidX+nHi)};
+    } else {
+      nInHi = (nIn-1) / 2;
+      nL = nLo;
+      nR = (nHi < -2-nInHi)? nHi : -2-nInHi;
+      if (nL <= nR) {
+        asSpan[nSpanCnt++] = (gslc_tsSpan){(int16_t)(nMidY+nDY),(int16_t)(nMidX+nL),(int16_t)(nMidX+nR)};
+      }
+      nL = (nLo > nInHi+1)? nLo : nInHi+1;
+      nR = nHi;
+      if (nL <= nR) {
+        asSpan[nSpanCnt++] = (gslc_tsSpan){(int16_t)(nMidY+nDY),(int16_t)(nMidX+nL),(int16_t)(nMidX+nR)};
+      }
+    }
+    if (nSpanCnt > GSLC_SPAN_BATCH-2) {
+      gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
+      nSpanCnt = 0;
+    }
+  }
+  gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
+}
+
 void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArcStart, gslc_tsColor cArcEnd,bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,int16_t nAngSecStart,int16_t nAngSecEnd)
 {
-  gslc_tsPt anPts[4];
-
   // Calculate degrees per step (based on quality setting)
   int16_t nStepAng = 360 / nQuality;
   int16_t nStep64 = 64 * nStepAng;
 
-  int16_t nAng64;
-  int16_t nX, nY;
   int16_t nSegStart, nSegEnd;
   gslc_tsColor colSeg;
 
   nSegStart = nAngSecStart * (int32_t)nQuality / 360;
   nSegEnd = nAngSecEnd * (int32_t)nQuality / 360;
 
-  int16_t nSegGradStart, nSegGradRange;
-  nSegGradStart = nAngGradStart * (int32_t)nQuality / 360;
-  nSegGradRange = nAngGradRange * (int32_t)nQuality / 360;
-  nSegGradRange = (nSegGradRange == 0) ? 1 : nSegGradRange; // Guard against div/0
-
-  bool bClockwise;
-  int16_t nSegInd;
-  int16_t nStepCnt;
-  if (nSegEnd >= nSegStart) {
-    nStepCnt = nSegEnd - nSegStart;
-    bClockwise = true;
-  } else {
-    nStepCnt = nSegStart - nSegEnd;
-    bClockwise = false;
-  }
+  // The fill covers segments nSegLo..nSegHi-1 irrespective of direction
+  int16_t nSegLo = (nSegEnd >= nSegStart)? nSegStart : nSegEnd;
+  int16_t nSegHi = (nSegEnd >= nSegStart)? nSegEnd : nSegStart;
+
+  // Ensure the radii are ordered
+  int16_t nRadIn  = (nRad1 < nRad2)? nRad1 : nRad2;
+  int16_t nRadOut = (nRad1 < nRad2)? nRad2 : nRad1;
+  if (nRadIn < 0) { nRadIn = 0; }
 
   #if defined(DBG_REDRAW)
-  //GSLC_DEBUG_PRINT("FillSector: AngSecStart=%d AngSecEnd=%d SegStart=%d SegEnd=%d StepCnt=%d CW=%d\n",
-  //  nAngSecStart,nAngSecEnd,nSegStart,nSegEnd,nStepCnt,bClockwise);
+  //GSLC_DEBUG_PRINT("FillSector: AngSecStart=%d AngSecEnd=%d SegStart=%d SegEnd=%d\n",
+  //  nAngSecStart,nAngSecEnd,nSegStart,nSegEnd);
   #endif
 
-  for (int16_t nStepInd = 0; nStepInd < nStepCnt; nStepInd++) {
-    // Remap from the step to the segment index, depending on direction
-    nSegInd = (bClockwise)? (nSegStart + nStepInd) : (nSegStart - nStepInd - 1);
-
-    nAng64 = (int32_t)(nSegInd * nStep64) % (int32_t)(360 * 64);
-	
-    #if defined(DBG_REDRAW)
-    GSLC_DEBUG2_PRINT("FillSector:  StepInd=%d SegInd=%d (%d..%d) Ang64=%d\n", nStepInd, nSegInd, nSegStart, nSegEnd, nAng64);
-    #endif
-
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
-    anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
-    anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
-    anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
-    anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-
-    if (bGradient) {
-      // Gradient coloring
-      int16_t nGradPos = 1000 * (int32_t)(nSegInd-nSegGradStart) / nSegGradRange;
-      #if defined(DBG_REDRAW)
-      GSLC_DEBUG2_PRINT("FillSector:   GradPos=%d\n", nGradPos);
-      #endif
-      colSeg = gslc_ColorBlend2(cArcStart, cArcEnd, 500, nGradPos);
-    } else {
-      // Flat coloring
-      colSeg = cArcStart;
+  // Each wedge passed to gslc_DrawFillSectorWedge() is limited to 90 degrees
+  int32_t nAng64,nAngEnd64,nSpan64;
+  nAngEnd64 = (int32_t)nSegHi * nStep64;
+  if (bGradient) {
+    // Gradient coloring: the sector is divided into wedges that are
+    // narrow enough for adjacent wedges to differ by about one color
+    // level, and the spans of each wedge are given the color at the
+    // wedge's midpoint angle. The color is therefore interpolated
+    // continuously rather than stepped at each segment.
+    int16_t nDelta,nDeltaMax;
+    nDeltaMax = abs((int16_t)cArcEnd.r - (int16_t)cArcStart.r);
+    nDelta = abs((int16_t)cArcEnd.g - (int16_t)cArcStart.g);
+    nDeltaMax = (nDelta > nDeltaMax)? nDelta : nDeltaMax;
+    nDelta = abs((int16_t)cArcEnd.b - (int16_t)cArcStart.b);
+    nDeltaMax = (nDelta > nDeltaMax)? nDelta : nDeltaMax;
+    if (pGui->nDispDepth <= 16) {
+      // RGB565 resolves at most 64 levels per channel
+      nDeltaMax = (nDeltaMax + 3) / 4;
+    }
+    int32_t nGradStart64 = (int32_t)nAngGradStart * 64;
+    int32_t nGradRange64 = (int32_t)nAngGradRange * 64;
+    nGradRange64 = (nGradRange64 == 0) ? 1 : nGradRange64; // Guard against div/0
+    int32_t nGradStep64 = (nDeltaMax > 0)? ((nGradRange64 < 0)? -nGradRange64 : nGradRange64) / nDeltaMax : nStep64;
+    nGradStep64 = (nGradStep64 > nStep64)? nStep64 : nGradStep64;
+    nGradStep64 = (nGradStep64 < GSLC_SECTOR_GRAD_STEP64)? GSLC_SECTOR_GRAD_STEP64 : nGradStep64;
+    nGradStep64 = (nGradStep64 > 90*64)? 90*64 : nGradStep64;
+    int32_t nGradPos;
+    for (nAng64 = (int32_t)nSegLo * nStep64; nAng64 < nAngEnd64; nAng64 += nSpan64) {
+      nSpan64 = nAngEnd64 - nAng64;
+      nSpan64 = (nSpan64 > nGradStep64)? nGradStep64 : nSpan64;
+      nGradPos = 1000 * (nAng64 + nSpan64/2 - nGradStart64) / nGradRange64;
+      nGradPos = (nGradPos < 0)? 0 : nGradPos;
+      nGradPos = (nGradPos > 1000)? 1000 : nGradPos;
+      colSeg = gslc_ColorBlend2(cArcStart, cArcEnd, 500, (uint16_t)nGradPos);
+      gslc_DrawFillSectorWedge(pGui, nMidX, nMidY, nRadIn, nRadOut, nAng64, nSpan64, colSeg);
+    }
+  } else {
+    // Flat coloring: the segments can be merged
+    for (nAng64 = (int32_t)nSegLo * nStep64; nAng64 < nAngEnd64; nAng64 += nSpan64) {
+      nSpan64 = nAngEnd64 - nAng64;
+      nSpan64 = (nSpan64 > 90*64)? 90*64 : nSpan64;
+      gslc_DrawFillSectorWedge(pGui, nMidX, nMidY, nRadIn, nRadOut, nAng64, nSpan64, cArcStart);
     }
-    
-    gslc_DrawFillQuad(pGui, anPts, colSeg);
   }
 }
 
@@ -1868,6 +2410,20 @@ void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int1
 // Font Functions
 // -----------------------------------------------------------------------
 
+// Invalidate the cached text extents of all elements
+static void gslc_TxtSzInvalidateAll(gslc_tsGui* pGui)
+{
+  #if (GSLC_FEATURE_TXT_SZ_CACHE)
+  // Generation 0 is reserved for elements that haven't been measured
+  pGui->nTxtSzGen++;
+  if (pGui->nTxtSzGen == 0) {
+    pGui->nTxtSzGen = 1;
+  }
+  #else
+  (void)pGui; // Unused
+  #endif
+}
+
 bool gslc_FontSetBase(gslc_tsGui* pGui, uint8_t nFontInd, int16_t nFontId, gslc_teFontRefType eFontRefType,
   const void* pvFontRef, uint16_t nFontSz)
 {
@@ -1890,6 +2446,9 @@ bool gslc_FontSetBase(gslc_tsGui* pGui, uint8_t nFontInd, int16_t nFontId, gslc_
     pGui->asFont[nFontInd].nId          = nFontId;
     pGui->asFont[nFontInd].nSize        = nFontSz;
 
+    // Any cached text extents may no longer be valid
+    gslc_TxtSzInvalidateAll(pGui);
+
     return true;
   }
 }
@@ -1958,6 +2517,9 @@ bool gslc_FontSetMode(gslc_tsGui* pGui, int16_t nFontId, gslc_teFontRefMode eFon
     return false;
   }
   pFont->eFontRefMode = eFontMode;
+
+  // Any cached text extents may no longer be valid
+  gslc_TxtSzInvalidateAll(pGui);
   return true;
 }
 
@@ -2083,6 +2645,14 @@ void gslc_SetStackPage(gslc_tsGui* pGui, uint8_t nStackPos, int16_t nPageId)
   // Save a reference to the selected page
   pGui->apPageStack[nStackPos] = pPage;
 
+  #if (GSLC_FEATURE_SAVE_UNDER)
+  // Any pixels saved under the previous overlay no longer apply
+  if ((nStackPos == GSLC_STACK_OVERLAY) && (nPageSaved != nPageId)) {
+    pGui->bSavePend  = false;
+    pGui->bSaveValid = false;
+  }
+  #endif
+
   #if defined(DEBUG_LOG)
   GSLC_DEBUG_PRINT("INFO: Changed PageStack[%u] to page %u\n",nStackPos,nPageId);
   #endif
@@ -2145,9 +2715,135 @@ void gslc_SetPageOverlay(gslc_tsGui* pGui,int16_t nPageId)
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
 }
 
+#if (GSLC_FEATURE_SAVE_UNDER)
+// Mark the area drawn by a page below the popup as requiring
+// a redraw once the saved pixels have been restored
+// - The rect is limited to the region being redrawn and
+//   the region saved under the popup
+// - bFull indicates that the background was drawn, in which
+//   case the area can't be restored by redrawing elements alone
+static void gslc_SaveUnderDirtyAdd(gslc_tsGui* pGui,gslc_tsRect rRect,bool bFull)
+{
+  if (!pGui->bSaveValid || (pGui->nRedrawStack == GSLC_STACK_OVERLAY)) {
+    return;
+  }
+  if (pGui->bRedrawRgnEn && !gslc_ClipRect(&(pGui->rRedrawRgn),&rRect)) {
+    return;
+  }
+  if (!gslc_ClipRect(&(pGui->rSave),&rRect)) {
+    return;
+  }
+  if (pGui->bSaveDirty) {
+    gslc_UnionRect(&(pGui->rSaveDirty),rRect);
+  } else {
+    pGui->rSaveDirty = rRect;
+    pGui->bSaveDirty = true;
+  }
+  if (bFull) {
+    pGui->bSaveDirtyFull = true;
+  }
+}
+
+#if (DRV_HAS_READ_RECT)
+// Remove the popup by writing back the pixels saved under it
+// - Returns false if the pages below need to be redrawn instead
+static bool gslc_PopupRestore(gslc_tsGui* pGui)
+{
+  if (!pGui->bSaveValid) {
+    return false;
+  }
+  pGui->bSaveValid = false;
+  pGui->bSavePend  = false;
+  if (!gslc_DrvWriteRect(pGui,pGui->rSave,pGui->pSaveBuf)) {
+    return false;
+  }
+  pGui->apPageStack[GSLC_STACK_OVERLAY] = NULL;
+
+  // Mark the elements on the pages below for redraw:
+  // - Elements that were drawn under the popup since it was shown
+  //   (approximated by those overlapping the changed area)
+  // - Elements that are still pending a redraw as they were marked
+  //   while a modal popup was shown. Their regions need to be
+  //   invalidated again as these were reset by the earlier redraws.
+  bool bDirtyElem = pGui->bSaveDirty && !pGui->bSaveDirtyFull;
+  for (uint8_t nStackPage = 0; nStackPage < GSLC_STACK_OVERLAY; nStackPage++) {
+    gslc_tsPage* pPage = pGui->apPageStack[nStackPage];
+    if (pPage == NULL) {
+      continue;
+    }
+    gslc_tsCollect* pCollect = &pPage->sCollect;
+    for (uint16_t nInd = 0; nInd < pCollect->nElemRefCnt; nInd++) {
+      gslc_tsElemRef* pElemRef = &(pCollect->asElemRef[nInd]);
+      gslc_teRedrawType eRedraw = gslc_ElemGetRedraw(pGui,pElemRef);
+      if (bDirtyElem && gslc_IsRectOverlap(gslc_GetElemFromRef(pGui,pElemRef)->rElem,pGui->rSaveDirty)) {
+        eRedraw = GSLC_REDRAW_FULL;
+      }
+      if (eRedraw != GSLC_REDRAW_NONE) {
+        gslc_ElemSetRedraw(pGui,pElemRef,eRedraw);
+      }
+    }
+  }
+
+  // If the background was drawn under the popup then the
+  // changed area is redrawn in full
+  if (pGui->bSaveDirtyFull) {
+    gslc_InvalidateRgnAdd(pGui,pGui->rSaveDirty);
+    gslc_PageRedrawSet(pGui,true);
+  }
+
+  // Ensure the restored pixels are shown
+  gslc_PageFlipSet(pGui,true);
+  pGui->bRedrawNeeded = true;
+  return true;
+}
+#endif // DRV_HAS_READ_RECT
+
+bool gslc_PopupSetSaveBuf(gslc_tsGui* pGui, uint8_t* pBuf, uint32_t nBufLen)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "PopupSetSaveBuf";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  pGui->pSaveBuf    = pBuf;
+  pGui->nSaveBufLen = (pBuf == NULL)? 0 : nBufLen;
+  pGui->bSavePend   = false;
+  pGui->bSaveValid  = false;
+  #if (DRV_HAS_READ_RECT)
+  return true;
+  #else
+  return false;
+  #endif
+}
+#else
+bool gslc_PopupSetSaveBuf(gslc_tsGui* pGui, uint8_t* pBuf, uint32_t nBufLen)
+{
+  (void)pGui;     // Unused
+  (void)pBuf;     // Unused
+  (void)nBufLen;  // Unused
+  return false;
+}
+#endif // GSLC_FEATURE_SAVE_UNDER
+
 void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
 {
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
+
+  #if (GSLC_FEATURE_SAVE_UNDER) && (DRV_HAS_READ_RECT)
+  // Capture the pixels under the popup when it is first drawn
+  // - This relies on partial redraw so that the pages below
+  //   are left intact outside of the invalidated regions
+  gslc_tsPage* pPage = pGui->apPageStack[GSLC_STACK_OVERLAY];
+  if ((pGui->pSaveBuf != NULL) && (pPage != NULL) && (pGui->bRedrawPartialEn) && (!pGui->bSaveValid)) {
+    gslc_tsRect rDisp = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+    gslc_tsRect rSave = pPage->rBounds;
+    if ((rSave.w > 0) && (rSave.h > 0) && gslc_ClipRect(&rDisp,&rSave) &&
+      (gslc_DrvReadRectLen(pGui,rSave) <= pGui->nSaveBufLen)) {
+      pGui->rSave     = rSave;
+      pGui->bSavePend = true;
+    }
+  }
+  #endif
   // If modal dialog selected, then deactivate other pages in stack
   // If modeless dialog selected, then don't deactivate other pages in stack
   if (bModal) {
@@ -2178,7 +2874,13 @@ void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
 
 void gslc_PopupHide(gslc_tsGui* pGui)
 {
-  gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, GSLC_PAGE_NONE);
+  bool bRestored = false;
+  #if (GSLC_FEATURE_SAVE_UNDER) && (DRV_HAS_READ_RECT)
+  bRestored = gslc_PopupRestore(pGui);
+  #endif
+  if (!bRestored) {
+    gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, GSLC_PAGE_NONE);
+  }
   // Ensure other pages in stack are activated
   // - This is done in case they were deactivated due to a modal popup
   gslc_SetStackState(pGui, GSLC_STACK_CUR, true, true);
@@ -2228,12 +2930,14 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui)
 // - The typical case for this being required is when an element
 //   requires redraw but it is marked as being transparent. Therefore,
 //   the lower level elements should be redrawn.
-// - For now, just mark the entire page as requiring redraw.
-// TODO: Determine which elements underneath should be redrawn based
-//       on the region exposed by the transparent element.
+// - If partial redraw is supported, the invalidated regions that
+//   overlap the transparent element are marked for a full redraw.
+//   The background and any elements in the page stack that
+//   overlap these regions are then redrawn, clipped to the region.
 void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 {
   uint16_t          nInd;
+  uint8_t           nRgn;
   int               nStackPage;
   gslc_tsElem*      pElem = NULL;
   gslc_tsElemRef*   pElemRef = NULL;
@@ -2242,6 +2946,10 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
   bool  bRedrawFullPage = false;  // Does entire page require redraw?
   gslc_tsPage*  pPage = NULL;
 
+  for (nRgn=0;nRgn<pGui->nInvalidateRectCnt;nRgn++) {
+    pGui->abInvalidateRectFull[nRgn] = false;
+  }
+
   // Work on each enabled page in the stack
   for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
     // Select the page collection to process
@@ -2256,8 +2964,15 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
     }
     pCollect = &pPage->sCollect;
 
-    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
-      pElemRef = &pCollect->asElemRef[nInd];
+    // Only the elements in the dirty list need to be checked
+    // unless the list is incomplete
+    uint16_t nScanCnt = (pCollect->bElemRefDirtyAll)? pCollect->nElemRefCnt : pCollect->nElemRefDirtyCnt;
+    for (nInd=0;nInd<nScanCnt;nInd++) {
+      if (pCollect->bElemRefDirtyAll) {
+        pElemRef = &pCollect->asElemRef[nInd];
+      } else {
+        pElemRef = &pCollect->asElemRef[pCollect->anElemRefDirty[nInd]];
+      }
       gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
       pElem = gslc_GetElemFromRef(pGui,pElemRef);
       //GSLC_DEBUG2_PRINT("PageRedrawCalc: Ind=%u ID=%u redraw=%u flags_old=%u fea=%u\n",nInd,pElem->nId,
@@ -2268,13 +2983,21 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 
         // If partial redraw is supported, then we
         // look out for transparent elements which may
-        // still warrant full page redraw.
+        // still warrant a redraw of the region underneath.
         if (pGui->bRedrawPartialEn) {
           // Is the element transparent?
-          // FIXME: Instead of forcing full page redraw, consider
-          // using clipping region for partial redraw
           if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
-            bRedrawFullPage = true;
+            if (!pGui->bInvalidateEn) {
+              // No region to limit the redraw
+              bRedrawFullPage = true;
+            } else {
+              // Mark the regions exposed by the element
+              for (nRgn=0;nRgn<pGui->nInvalidateRectCnt;nRgn++) {
+                if (gslc_IsRectOverlap(pGui->asInvalidateRect[nRgn],pElem->rElem)) {
+                  pGui->abInvalidateRectFull[nRgn] = true;
+                }
+              }
+            }
           }
         } else {
           bRedrawFullPage = true;
@@ -2298,48 +3021,37 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 
 }
 
-// Redraw the active page
-// - If the page has been marked as needing redraw, then all
-//   elements are rendered
-// - If the entire page has not been marked as needing redraw then only
-//   the elements that have been marked as needing redraw
-//   are rendered.
-void gslc_PageRedrawGo(gslc_tsGui* pGui)
+// Determine if a rect lies entirely within one of the invalidated
+// regions that have been marked for a full redraw
+static bool gslc_InvalidateRgnFullContains(gslc_tsGui* pGui,gslc_tsRect rRect)
 {
-  // Update any page redraw status that may be required
-  // - Note that this routine handles cases where an element
-  //   marked as requiring update is semi-transparent which can
-  //   cause other elements to be redrawn as well.
-  gslc_PageRedrawCalc(pGui);
-
-  // Determine final state of full-screen redraw
-  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
-
-  // Set the clipping based on the current invalidated region
-  if (pGui->bInvalidateEn) {
-    #if defined(DBG_REDRAW)
-    // Note that this will still outline the invalidation region
-    // even if we later discover that the changed element is on
-    // a page in the stack that has been disabled through
-    // abPageStackDoDraw[] = false.
-    GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: En=%d (%d,%u)-(%d,%d) PageRedraw=%d\n",
-      pGui->bInvalidateEn, pGui->rInvalidateRect.x, pGui->rInvalidateRect.y,
-      pGui->rInvalidateRect.x + pGui->rInvalidateRect.w - 1,
-      pGui->rInvalidateRect.y + pGui->rInvalidateRect.h - 1, bPageRedraw);
-
-    // Mark the invalidation region
-    gslc_DrvDrawFrameRect(pGui, pGui->rInvalidateRect, GSLC_COL_RED);
+  for (uint8_t nRgn = 0; nRgn < pGui->nInvalidateRectCnt; nRgn++) {
+    if (!pGui->abInvalidateRectFull[nRgn]) {
+      continue;
+    }
+    gslc_tsRect rRgn = pGui->asInvalidateRect[nRgn];
+    if ((rRect.x >= rRgn.x) && (rRect.y >= rRgn.y) &&
+      (rRect.x + rRect.w <= rRgn.x + rRgn.w) && (rRect.y + rRect.h <= rRgn.y + rRgn.h)) {
+      return true;
+    }
+  }
+  return false;
+}
 
-    // Slow down rendering
-    delay(1000);
-    #endif // DBG_REDRAW
+// Redraw the page stack within a region of the display
+// - If pRect is NULL then the entire display is redrawn
+// - If bPageRedraw is true then the background and all elements
+//   are drawn, otherwise only the elements marked as needing redraw
+static void gslc_PageRedrawRgn(gslc_tsGui* pGui,gslc_tsRect* pRect,bool bPageRedraw)
+{
+  // Set the clipping to the region
+  gslc_SetClipRect(pGui, pRect);
 
-    gslc_SetClipRect(pGui, &(pGui->rInvalidateRect));
-  }
-  else {
-    // No invalidation region defined, so default the
-    // clipping region to the entire display
-    gslc_SetClipRect(pGui, NULL);
+  // Elements that don't overlap the region can be skipped
+  // during a forced redraw
+  pGui->bRedrawRgnEn = (pRect != NULL);
+  if (pRect != NULL) {
+    pGui->rRedrawRgn = *pRect;
   }
 
   // If a full page redraw is required, then start by
@@ -2353,45 +3065,154 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   //   TODO: Fix this assumption (either add specific flag
   //         for bBkgndNeedRedraw or make the background just
   //         another element).
+  #if (GSLC_FEATURE_SAVE_UNDER)
+  pGui->nRedrawStack = GSLC_STACK_BASE;
+  #endif
   if (bPageRedraw) {
     gslc_DrvDrawBkgnd(pGui);
     gslc_PageFlipSet(pGui,true);
+    #if (GSLC_FEATURE_SAVE_UNDER)
+    gslc_SaveUnderDirtyAdd(pGui,(gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH },true);
+    #endif
+  }
+
+  // Draw other elements (as needed, unless forced page redraw)
+  // - When drawing as needed, only the elements in each page's
+  //   dirty list are visited (see gslc_CollectEvent)
+  uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
+  void*    pvData = NULL;
+
+  // Issue page redraw events to all pages in stack
+  // - Start from bottom page in stack first
+  for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
+    gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
+    if (!pStackPage) {
+      continue;
+    }
+    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
+      // When doing a full page redraw, proceed as normal
+      // When only doing a parital page redraw, check to see if
+      // the page has been marked as redraw-disabled. If so, skip
+      // updating the elements on the page.
+      //
+      // The redraw-disabled mode is useful to prevent "show-through"
+      // from dynamically-updating elements in lower layers of the
+      // page stack (this may occur with popup dialogs). If the overlay
+      // page does not overlap dynamically-updating elements, then
+      // DoDraw can be set to true, enabling background updates to occur.
+      continue;
+    }
+    #if (GSLC_FEATURE_SAVE_UNDER)
+    pGui->nRedrawStack = (uint8_t)nStackPage;
+    #endif
+    #if (GSLC_FEATURE_SAVE_UNDER) && (DRV_HAS_READ_RECT)
+    // Capture the pixels under a newly shown popup once the pages
+    // below have been redrawn across the whole of its region
+    if ((nStackPage == GSLC_STACK_OVERLAY) && (pGui->bSavePend) && (bPageRedraw)) {
+      gslc_tsRect rSave = pGui->rSave;
+      if ((pRect == NULL) || (gslc_ClipRect(pRect,&rSave) &&
+        (rSave.w == pGui->rSave.w) && (rSave.h == pGui->rSave.h))) {
+        pGui->bSavePend  = false;
+        pGui->bSaveValid = gslc_DrvReadRect(pGui,pGui->rSave,pGui->pSaveBuf);
+        pGui->bSaveDirty = false;
+        pGui->bSaveDirtyFull = false;
+      }
+    }
+    #endif
+    pvData = (void*)(pStackPage);
+    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
+    gslc_PageEvent(pGui,sEvent);
   }
 
-  // Draw other elements (as needed, unless forced page redraw)
-  // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
-  uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
-  void*    pvData = NULL;
+  pGui->bRedrawRgnEn = false;
+  #if (GSLC_FEATURE_SAVE_UNDER)
+  pGui->nRedrawStack = GSLC_STACK__MAX;
+  #endif
+}
+
+// Redraw the active page
+// - If the page has been marked as needing redraw, then all
+//   elements are rendered
+// - If the entire page has not been marked as needing redraw then only
+//   the elements that have been marked as needing redraw
+//   are rendered.
+void gslc_PageRedrawGo(gslc_tsGui* pGui)
+{
+  // Update any page redraw status that may be required
+  // - Note that this routine handles cases where an element
+  //   marked as requiring update is semi-transparent which can
+  //   cause other elements to be redrawn as well.
+  gslc_PageRedrawCalc(pGui);
+
+  // Determine final state of full-screen redraw
+  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
+  uint8_t nRgn;
+
+  #if (DRV_HAS_REDRAW_BATCH)
+  // Allow the driver to group all of the drawing below
+  // into a single display bus transaction
+  gslc_DrvRedrawBegin(pGui);
+  #endif
 
-  // TODO: Consider creating a flag that indicates whether any elements
-  // on the page have requested redraw. This would enable us to skip
-  // over this exhaustive search every time we call Update()
+  #if defined(DBG_REDRAW)
+  // Note that this will still outline the invalidation regions
+  // even if we later discover that the changed element is on
+  // a page in the stack that has been disabled through
+  // abPageStackDoDraw[] = false.
+  for (nRgn = 0; nRgn < pGui->nInvalidateRectCnt; nRgn++) {
+    gslc_tsRect rRgn = pGui->asInvalidateRect[nRgn];
+    GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn[%u]: (%d,%d)-(%d,%d) PageRedraw=%d\n",
+      nRgn, rRgn.x, rRgn.y, rRgn.x + rRgn.w - 1, rRgn.y + rRgn.h - 1, bPageRedraw);
 
-  // Issue page redraw events to all pages in stack
-  // - Start from bottom page in stack first
-  for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
-    gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
-    if (!pStackPage) {
-      continue;
+    // Mark the invalidation region
+    gslc_DrvDrawFrameRect(pGui, rRgn, GSLC_COL_RED);
+  }
+  if (pGui->bInvalidateEn) {
+    // Slow down rendering
+    delay(1000);
+  }
+  #endif // DBG_REDRAW
+
+  if (!pGui->bInvalidateEn) {
+    // No invalidation region defined, so default the
+    // clipping region to the entire display
+    gslc_PageRedrawRgn(pGui, NULL, bPageRedraw);
+  } else if (bPageRedraw) {
+    // Redraw each invalidated region separately so that
+    // widely-separated changes don't cause the area between
+    // them to be redrawn
+    for (nRgn = 0; nRgn < pGui->nInvalidateRectCnt; nRgn++) {
+      gslc_PageRedrawRgn(pGui, &(pGui->asInvalidateRect[nRgn]), true);
     }
-    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
-      // When doing a full page redraw, proceed as normal
-      // When only doing a parital page redraw, check to see if
-      // the page has been marked as redraw-disabled. If so, skip
-      // updating the elements on the page.
-      //
-      // The redraw-disabled mode is useful to prevent "show-through"
-      // from dynamically-updating elements in lower layers of the
-      // page stack (this may occur with popup dialogs). If the overlay
-      // page does not overlap dynamically-updating elements, then
-      // DoDraw can be set to true, enabling background updates to occur.
-      continue;
+  } else {
+    // Only the elements marked as needing redraw are drawn, and
+    // each of these is drawn once, so clip to the bounding rect
+    // of all invalidated regions
+    // - Transparent elements are skipped in this pass as they
+    //   are drawn with the regions that they expose below
+    gslc_tsRect rBounds = pGui->asInvalidateRect[0];
+    for (nRgn = 1; nRgn < pGui->nInvalidateRectCnt; nRgn++) {
+      gslc_UnionRect(&rBounds, pGui->asInvalidateRect[nRgn]);
+    }
+    gslc_PageRedrawRgn(pGui, &rBounds, false);
+
+    // Redraw the regions exposed by transparent elements, including
+    // the background and all overlapping elements. This is done
+    // after the pass above so that any opaque element that extends
+    // outside of the region has already been drawn in full.
+    for (nRgn = 0; nRgn < pGui->nInvalidateRectCnt; nRgn++) {
+      if (pGui->abInvalidateRectFull[nRgn]) {
+        gslc_PageRedrawRgn(pGui, &(pGui->asInvalidateRect[nRgn]), true);
+      }
     }
-    pvData = (void*)(pStackPage);
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
-    gslc_PageEvent(pGui,sEvent);
   }
 
+  // Drop the drawn elements from the dirty lists
+  for (nRgn = 0; nRgn < GSLC_STACK__MAX; nRgn++) {
+    if (pGui->apPageStack[nRgn]) {
+      gslc_CollectDirtyUpdate(pGui, &(pGui->apPageStack[nRgn]->sCollect));
+    }
+  }
 
   // Clear the page redraw flag
   gslc_PageRedrawSet(pGui,false);
@@ -2405,6 +3226,10 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   // Clear the "need redraw" flag
   pGui->bRedrawNeeded = false;
 
+  #if (DRV_HAS_REDRAW_BATCH)
+  gslc_DrvRedrawEnd(pGui);
+  #endif
+
   // Page flip the entire screen
   // - TODO: We could also call Update instead of Flip as that would
   //         limit the region to refresh.
@@ -2886,11 +3711,25 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
       gslc_teRedrawType eRedraw = gslc_ElemGetRedraw(pGui,pElemRef);
 
       if (sEvent.nSubType == GSLC_EVTSUB_DRAW_FORCE) {
+        // During a page redraw of an invalidated region, elements
+        // outside of the region would be entirely clipped
+        if (pGui->bRedrawRgnEn && !gslc_IsRectOverlap(pElem->rElem,pGui->rRedrawRgn)) {
+          return true;
+        }
         // Despite the current pending redraw state of the element,
         // we will force a full redraw as requested.
         //GSLC_DEBUG_PRINT("DBG: ElemEvent(Draw) nId=%d eRedraw=%d: force to FULL\n",pElem->nId,eRedraw);
         return gslc_ElemDrawByRef(pGui,pElemRef,GSLC_REDRAW_FULL);
       } else if (eRedraw != GSLC_REDRAW_NONE) {
+        // Transparent elements, and any elements that lie entirely
+        // within a region exposed by a transparent element, are
+        // drawn during the redraw of that region
+        // (see gslc_PageRedrawCalc)
+        if (pGui->bRedrawRgnEn && pGui->bRedrawPartialEn) {
+          if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN) || gslc_InvalidateRgnFullContains(pGui,pElem->rElem)) {
+            return true;
+          }
+        }
         // There is a pending redraw for the element. It may
         // either be an incremental or full redraw.
         //GSLC_DEBUG_PRINT("DBG: ElemEvent(Draw) nId=%d eRedraw=%d\n",pElem->nId,eRedraw);
@@ -2981,8 +3820,26 @@ void gslc_ElemDraw(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
   gslc_ElemEvent(pGui,sEvent);
 }
 
-void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
-  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+#if (GSLC_FEATURE_TXT_SZ_CACHE) && (DRV_HAS_DRAW_TEXT) && !(DRV_OVERRIDE_TXT_ALIGN)
+// Hash the text string and encoding used to validate a cached text extent
+static uint16_t gslc_TxtSzHash(const char* pStrBuf,gslc_teTxtFlags eTxtFlags)
+{
+  uint16_t nHash = 0x811C ^ (uint16_t)(eTxtFlags & (GSLC_TXT_ENC | GSLC_TXT_MEM));
+  if ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG) {
+    // String in FLASH can't change, so only its location is used
+    return nHash ^ (uint16_t)(uintptr_t)pStrBuf;
+  }
+  while (*pStrBuf) {
+    nHash = (nHash ^ (uint8_t)(*pStrBuf++)) * 0x0193;
+  }
+  return nHash;
+}
+#endif // GSLC_FEATURE_TXT_SZ_CACHE && DRV_HAS_DRAW_TEXT && !DRV_OVERRIDE_TXT_ALIGN
+
+// Draw text with alignment, optionally using the text extent
+// cached in an element (pElemSz) instead of measuring the text
+static void gslc_DrawTxtBaseSz(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH,gslc_tsElem* pElemSz)
 {
   int16_t   nElemX,nElemY;
   uint16_t  nElemW,nElemH;
@@ -3024,6 +3881,7 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
 
     gslc_DrvDrawTxtAlign(pGui,nX0,nY0,nX1,nY1,eTxtAlign,pTxtFont,
             pStrBuf,eTxtFlags,colTxt,colBg);
+    (void)pElemSz; // Unused
 
 #else // DRV_OVERRIDE_TXT_ALIGN
 
@@ -3045,7 +3903,32 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     int16_t       nTxtOffsetY=0;
     uint16_t      nTxtSzW=0;
     uint16_t      nTxtSzH=0;
+#if (GSLC_FEATURE_TXT_SZ_CACHE)
+    uint16_t      nTxtSzHash = 0;
+    if (pElemSz != NULL) {
+      nTxtSzHash = gslc_TxtSzHash(pStrBuf,eTxtFlags);
+    }
+    if ((pElemSz != NULL) && (pElemSz->nTxtSzGen == pGui->nTxtSzGen) && (pElemSz->nTxtSzHash == nTxtSzHash)) {
+      // Reuse the extent measured during a previous draw
+      nTxtOffsetX = pElemSz->nTxtSzOffsetX;
+      nTxtOffsetY = pElemSz->nTxtSzOffsetY;
+      nTxtSzW     = pElemSz->nTxtSzW;
+      nTxtSzH     = pElemSz->nTxtSzH;
+    } else {
+      gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+      if (pElemSz != NULL) {
+        pElemSz->nTxtSzOffsetX  = nTxtOffsetX;
+        pElemSz->nTxtSzOffsetY  = nTxtOffsetY;
+        pElemSz->nTxtSzW        = nTxtSzW;
+        pElemSz->nTxtSzH        = nTxtSzH;
+        pElemSz->nTxtSzHash     = nTxtSzHash;
+        pElemSz->nTxtSzGen      = pGui->nTxtSzGen;
+      }
+    }
+#else
+    (void)pElemSz; // Unused
     gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+#endif
 
     // Calculate the text alignment
     int16_t       nTxtX,nTxtY;
@@ -3073,10 +3956,225 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
 
 #else // DRV_HAS_DRAW_TEXT
     // No text support in driver, so skip
+    (void)pElemSz; // Unused
 #endif // DRV_HAS_DRAW_TEXT
   }
 }
 
+void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+{
+  gslc_DrawTxtBaseSz(pGui,pStrBuf,rTxt,pTxtFont,eTxtFlags,eTxtAlign,colTxt,colBg,nMarginW,nMarginH,NULL);
+}
+
+#if (GSLC_FEATURE_ELEM_CACHE) && (DRV_HAS_READ_RECT)
+// Discard all of the cached element renderings
+static void gslc_ElemCacheReset(gslc_tsGui* pGui)
+{
+  pGui->nElemCacheBufNext = 0;
+  for (uint16_t nInd = 0; nInd < GSLC_ELEM_CACHE_MAX; nInd++) {
+    pGui->asElemCache[nInd].pElemRef = NULL;
+  }
+}
+
+// Accumulate data into a rendered element cache hash (FNV-1a)
+static uint32_t gslc_ElemCacheHashAdd(uint32_t nHash,const void* pvData,uint16_t nLen)
+{
+  const uint8_t* pData = (const uint8_t*)pvData;
+  while (nLen--) {
+    nHash = (nHash ^ *(pData++)) * 16777619UL;
+  }
+  return nHash;
+}
+
+// Hash everything that determines the pixels produced by the
+// default element rendering in its current state
+// - colBack is the color shown behind the corners of rounded elements
+static uint32_t gslc_ElemCacheHash(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsRectState* pState,gslc_tsColor colBack)
+{
+  uint32_t nHash = 2166136261UL;
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pState->rFull),sizeof(gslc_tsRect));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pState->rInner),sizeof(gslc_tsRect));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pState->colFrm),sizeof(gslc_tsColor));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pState->colInner),sizeof(gslc_tsColor));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pState->colTxtFore),sizeof(gslc_tsColor));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pState->colTxtBack),sizeof(gslc_tsColor));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->nFeatures),sizeof(pElem->nFeatures));
+  nHash = gslc_ElemCacheHashAdd(nHash,&colBack,sizeof(gslc_tsColor));
+  if (pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN) {
+    nHash = gslc_ElemCacheHashAdd(nHash,&(pGui->nRoundRadius),sizeof(pGui->nRoundRadius));
+  }
+
+  // Images are identified by their source
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->sImgRefNorm.pImgBuf),sizeof(pElem->sImgRefNorm.pImgBuf));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->sImgRefNorm.pFname),sizeof(pElem->sImgRefNorm.pFname));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->sImgRefNorm.eImgFlags),sizeof(pElem->sImgRefNorm.eImgFlags));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->sImgRefGlow.pImgBuf),sizeof(pElem->sImgRefGlow.pImgBuf));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->sImgRefGlow.pFname),sizeof(pElem->sImgRefGlow.pFname));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->sImgRefGlow.eImgFlags),sizeof(pElem->sImgRefGlow.eImgFlags));
+  nHash = gslc_ElemCacheHashAdd(nHash,&(pGui->sTransCol),sizeof(gslc_tsColor));
+
+  // The local string buffer is an array, so only the flag indicates
+  // whether a string is present
+  #if (GSLC_LOCAL_STR)
+  bool bHasTxt = ((pElem->eTxtFlags & GSLC_TXT_ALLOC) != GSLC_TXT_ALLOC_NONE);
+  #else
+  bool bHasTxt = ((pElem->pStrBuf != NULL) && ((pElem->eTxtFlags & GSLC_TXT_ALLOC) != GSLC_TXT_ALLOC_NONE));
+  #endif
+  if (bHasTxt) {
+    nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->eTxtFlags),sizeof(pElem->eTxtFlags));
+    nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->eTxtAlign),sizeof(pElem->eTxtAlign));
+    nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->nTxtMarginX),sizeof(pElem->nTxtMarginX));
+    nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->nTxtMarginY),sizeof(pElem->nTxtMarginY));
+    if (pElem->pTxtFont) {
+      nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->pTxtFont->pvFont),sizeof(pElem->pTxtFont->pvFont));
+      nHash = gslc_ElemCacheHashAdd(nHash,&(pElem->pTxtFont->nSize),sizeof(pElem->pTxtFont->nSize));
+    }
+    if ((pElem->eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG) {
+      // String in FLASH can't change, so only its location is used
+      const char* pStr = pElem->pStrBuf;
+      nHash = gslc_ElemCacheHashAdd(nHash,&pStr,sizeof(pStr));
+    } else {
+      nHash = gslc_ElemCacheHashAdd(nHash,pElem->pStrBuf,(uint16_t)strlen(pElem->pStrBuf));
+    }
+  }
+  return nHash;
+}
+
+// Find the cache entry for an element state
+// - A NULL pElemRef finds an unused entry
+static gslc_tsElemCache* gslc_ElemCacheFind(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bGlow)
+{
+  for (uint16_t nInd = 0; nInd < GSLC_ELEM_CACHE_MAX; nInd++) {
+    gslc_tsElemCache* pCache = &(pGui->asElemCache[nInd]);
+    if ((pCache->pElemRef == pElemRef) && ((pElemRef == NULL) || (pCache->bGlow == bGlow))) {
+      return pCache;
+    }
+  }
+  return NULL;
+}
+
+// Determine the solid color drawn behind an element
+// - Within a compound element this is the fill of the parent, provided
+//   that the parent draws nothing else there. Otherwise it is the page
+//   background, provided that it is a solid color.
+static bool gslc_ElemCacheBackCol(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsRect rCache,gslc_tsColor* pColBack)
+{
+  gslc_tsElemRef* pParentRef = pElem->pElemRefParent;
+  if (pParentRef == NULL) {
+    *pColBack = pGui->colBkgnd;
+    return pGui->bBkgndColEn;
+  }
+  gslc_tsElem* pParent = gslc_GetElemFromRef(pGui,pParentRef);
+  if ((pParent == NULL) || (pParent->pfuncXDraw != NULL) ||
+    (pParent->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) ||
+    ((pParent->eTxtFlags & GSLC_TXT_ALLOC) != GSLC_TXT_ALLOC_NONE)) {
+    return false;
+  }
+  if ((pParent->nFeatures & (GSLC_ELEM_FEA_FILL_EN | GSLC_ELEM_FEA_ROUND_EN)) != GSLC_ELEM_FEA_FILL_EN) {
+    return false;
+  }
+  gslc_tsRectState sState;
+  gslc_ElemCalcRectState(pGui,pParentRef,&sState);
+  if ((rCache.x < sState.rInner.x) || (rCache.y < sState.rInner.y) ||
+    (rCache.x + rCache.w > sState.rInner.x + sState.rInner.w) ||
+    (rCache.y + rCache.h > sState.rInner.y + sState.rInner.h)) {
+    return false;
+  }
+  *pColBack = sState.colInner;
+  return true;
+}
+
+// Determine if an element's default rendering can be cached
+// - Its pixels must not depend on anything drawn behind it other than
+//   a known solid color (returned in pColBack), and they must lie
+//   within the clipping region so that they are all rendered by the
+//   current draw
+static bool gslc_ElemCacheEn(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsRect rCache,gslc_tsColor* pColBack)
+{
+  *pColBack = GSLC_COL_BLACK;
+  if ((pGui->pElemCacheBuf == NULL) || (pElem->nType == GSLC_TYPE_LINE)) {
+    return false;
+  }
+  uint16_t nFeatures = pElem->nFeatures & (GSLC_ELEM_FEA_CACHE_EN | GSLC_ELEM_FEA_FILL_EN);
+  if (nFeatures != (GSLC_ELEM_FEA_CACHE_EN | GSLC_ELEM_FEA_FILL_EN)) {
+    return false;
+  }
+  // The corners of a rounded element show whatever is behind it
+  if ((pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN) && (!gslc_ElemCacheBackCol(pGui,pElem,rCache,pColBack))) {
+    return false;
+  }
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  return ((rCache.x >= rClip.x) && (rCache.y >= rClip.y) &&
+    (rCache.x + rCache.w <= rClip.x + rClip.w) && (rCache.y + rCache.h <= rClip.y + rClip.h));
+}
+
+// Reserve space for a new rendering in the cache
+// - The buffer is used as a ring so that the oldest renderings
+//   are the ones replaced once it is full
+static gslc_tsElemCache* gslc_ElemCacheAlloc(gslc_tsGui* pGui,uint32_t nLen)
+{
+  uint32_t nOfs = pGui->nElemCacheBufNext;
+  if (nOfs + nLen > pGui->nElemCacheBufLen) {
+    nOfs = 0;
+  }
+  // Discard the renderings that will be overwritten
+  gslc_tsElemCache* pCache = NULL;
+  for (uint16_t nInd = 0; nInd < GSLC_ELEM_CACHE_MAX; nInd++) {
+    gslc_tsElemCache* pEnt = &(pGui->asElemCache[nInd]);
+    if ((pEnt->pElemRef != NULL) && (pEnt->nBufOfs < nOfs + nLen) && (nOfs < pEnt->nBufOfs + pEnt->nBufLen)) {
+      pEnt->pElemRef = NULL;
+    }
+    if ((pEnt->pElemRef == NULL) && (pCache == NULL)) {
+      pCache = pEnt;
+    }
+  }
+  // If all of the entries are in use, replace the one that
+  // follows next in the ring
+  if (pCache == NULL) {
+    uint32_t nDist, nDistMin = UINT32_MAX;
+    for (uint16_t nInd = 0; nInd < GSLC_ELEM_CACHE_MAX; nInd++) {
+      gslc_tsElemCache* pEnt = &(pGui->asElemCache[nInd]);
+      nDist = (pEnt->nBufOfs >= nOfs)? pEnt->nBufOfs - nOfs : pEnt->nBufOfs + pGui->nElemCacheBufLen - nOfs;
+      if (nDist < nDistMin) {
+        nDistMin = nDist;
+        pCache = pEnt;
+      }
+    }
+  }
+  pCache->nBufOfs = nOfs;
+  pCache->nBufLen = nLen;
+  pGui->nElemCacheBufNext = nOfs + nLen;
+  return pCache;
+}
+
+// Capture the rendered pixels of an element state into the cache
+// - The existing entry is reused if its space is large enough
+static void gslc_ElemCacheCapture(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bGlow,uint32_t nHash,gslc_tsRect rCache)
+{
+  // Keep each entry aligned for 32-bit access
+  uint32_t nLen = (gslc_DrvReadRectLen(pGui,rCache) + 3) & ~(uint32_t)3;
+  if (nLen > pGui->nElemCacheBufLen) {
+    return;
+  }
+  gslc_tsElemCache* pCache = gslc_ElemCacheFind(pGui,pElemRef,bGlow);
+  if ((pCache != NULL) && (pCache->nBufLen < nLen)) {
+    pCache->pElemRef = NULL;
+    pCache = NULL;
+  }
+  if (pCache == NULL) {
+    pCache = gslc_ElemCacheAlloc(pGui,nLen);
+    pCache->pElemRef  = pElemRef;
+    pCache->bGlow     = bGlow;
+  }
+  pCache->nHash  = nHash;
+  pCache->rCache = rCache;
+  if (!gslc_DrvReadRect(pGui,rCache,pGui->pElemCacheBuf + pCache->nBufOfs)) {
+    pCache->pElemRef = NULL;
+  }
+}
+#endif // GSLC_FEATURE_ELEM_CACHE && DRV_HAS_READ_RECT
+
 // Draw an element to the active display
 // - Element is referenced by an element pointer
 // - TODO: Handle GSLC_TYPE_BKGND
@@ -3103,6 +4201,11 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     return true;
   }
 
+  #if (GSLC_FEATURE_SAVE_UNDER)
+  // Track drawing by the pages below a popup
+  gslc_SaveUnderDirtyAdd(pGui,pElem->rElem,false);
+  #endif
+
   // --------------------------------------------------------------------------
   // Init for default drawing
   // --------------------------------------------------------------------------
@@ -3165,6 +4268,23 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     return true;
   }
 
+  #if (GSLC_FEATURE_ELEM_CACHE) && (DRV_HAS_READ_RECT)
+  // Replace the rendering with the pixels captured by a previous
+  // draw if nothing affecting them has changed since
+  gslc_tsColor  colCacheBack;
+  bool          bCacheEn   = gslc_ElemCacheEn(pGui,pElem,sState.rFull,&colCacheBack);
+  uint32_t      nCacheHash = 0;
+  if (bCacheEn) {
+    nCacheHash = gslc_ElemCacheHash(pGui,pElem,&sState,colCacheBack);
+    gslc_tsElemCache* pCache = gslc_ElemCacheFind(pGui,pElemRef,bGlowing);
+    if ((pCache != NULL) && (pCache->nHash == nCacheHash) &&
+      gslc_DrvWriteRect(pGui,sState.rFull,pGui->pElemCacheBuf + pCache->nBufOfs)) {
+      gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+      return true;
+    }
+  }
+  #endif
+
 
   // --------------------------------------------------------------------------
   // Background
@@ -3235,11 +4355,24 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     int8_t        nMarginX  = pElem->nTxtMarginX;
     int8_t        nMarginY  = pElem->nTxtMarginY;
 
+    // The measured text extent is cached in the element unless
+    // the element is stored in FLASH
+    gslc_tsElem*  pElemSz   = NULL;
+    if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_RAM) {
+      pElemSz = pElem;
+    }
+
     // Note that we use the "inner" region for text placement to
     // avoid overlapping any frame
-    gslc_DrawTxtBase(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
-      pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY);
+    gslc_DrawTxtBaseSz(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
+      pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY, pElemSz);
+  }
+
+  #if (GSLC_FEATURE_ELEM_CACHE) && (DRV_HAS_READ_RECT)
+  if (bCacheEn) {
+    gslc_ElemCacheCapture(pGui,pElemRef,bGlowing,nCacheHash,sState.rFull);
   }
+  #endif
 
   // --------------------------------------------------------------------------
 
@@ -3292,6 +4425,37 @@ void gslc_ElemSetFrameEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bFrameEn
 
 }
 
+void gslc_ElemSetCacheEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bCacheEn)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return;
+
+  if (bCacheEn) {
+    pElem->nFeatures |= GSLC_ELEM_FEA_CACHE_EN;
+  } else {
+    pElem->nFeatures &= ~GSLC_ELEM_FEA_CACHE_EN;
+  }
+}
+
+bool gslc_ElemCacheSetBuf(gslc_tsGui* pGui,uint8_t* pBuf,uint32_t nBufLen)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemCacheSetBuf";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  #if (GSLC_FEATURE_ELEM_CACHE) && (DRV_HAS_READ_RECT)
+  pGui->pElemCacheBuf    = pBuf;
+  pGui->nElemCacheBufLen = (pBuf == NULL)? 0 : nBufLen;
+  gslc_ElemCacheReset(pGui);
+  return true;
+  #else
+  (void)pBuf;     // Unused
+  (void)nBufLen;  // Unused
+  return false;
+  #endif
+}
+
 void gslc_ElemSetRoundEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bRoundEn)
 {
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
@@ -3367,6 +4531,11 @@ void gslc_ElemSetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRect rEle
   // Update element
   pElem->rElem           = rElem;
 
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  // Touch area has changed, so the hit-test grids must be rebuilt
+  pGui->nTouchGridGen++;
+  #endif
+
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3442,6 +4611,9 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
 
   if (strncmp(pElem->pStrBuf,pStr,pElem->nStrBufMax)) {
     gslc_StrCopy(pElem->pStrBuf,pStr,pElem->nStrBufMax);
+    #if (GSLC_FEATURE_TXT_SZ_CACHE)
+    pElem->nTxtSzGen = 0;
+    #endif
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -3492,6 +4664,9 @@ void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
 
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_ENC) | (eFlags & GSLC_TXT_ENC);
+  #if (GSLC_FEATURE_TXT_SZ_CACHE)
+  pElem->nTxtSzGen = 0;
+  #endif
 }
 
 void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
@@ -3500,10 +4675,26 @@ void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
   if (!pElem) return;
 
   pElem->pTxtFont = gslc_FontGet(pGui,nFontId);
+  #if (GSLC_FEATURE_TXT_SZ_CACHE)
+  pElem->nTxtSzGen = 0;
+  #endif
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
 
+// Record an element that has been marked for redraw in the
+// dirty list of the page collection that contains it
+static void gslc_PageElemDirtyAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  for (uint8_t nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    gslc_tsCollect* pCollect = &(pGui->asPage[nPageInd].sCollect);
+    if ((pElemRef >= pCollect->asElemRef) && (pElemRef < pCollect->asElemRef + pCollect->nElemRefCnt)) {
+      gslc_CollectDirtyAdd(pCollect,(uint16_t)(pElemRef - pCollect->asElemRef));
+      return;
+    }
+  }
+}
+
 void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawType eRedraw)
 {
   if (pElemRef == NULL) {
@@ -3531,6 +4722,7 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
 
     // Indicate that at least one element requires redraw
     pGui->bRedrawNeeded = true;
+    gslc_PageElemDirtyAdd(pGui,pElemRef);
 
     // For all cases where a new redraw has been requested,
     // only update the redraw state if we are increasing
@@ -3872,6 +5064,11 @@ void gslc_ElemSetClickEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bClickEn
     pElem->nFeatures &= ~GSLC_ELEM_FEA_CLICK_EN;
   }
 
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  // Touch area has changed, so the hit-test grids must be rebuilt
+  pGui->nTouchGridGen++;
+  #endif
+
   #if (GSLC_FEATURE_INPUT)
   // For now, associate accepting click events as also accepting focus
   // We call this API since it also takes care of resizing 
@@ -3929,6 +5126,9 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   pElemDest->nTxtMarginX      = pElemSrc->nTxtMarginX;
   pElemDest->nTxtMarginY      = pElemSrc->nTxtMarginY;
   pElemDest->pTxtFont         = pElemSrc->pTxtFont;
+  #if (GSLC_FEATURE_TXT_SZ_CACHE)
+  pElemDest->nTxtSzGen        = 0;
+  #endif
 
   // pXData
 
@@ -5338,6 +6538,20 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
     return true;
     #endif  // !DRV_TOUCH_NONE
 
+  } else if ((sEvent.eType == GSLC_EVT_DRAW) && (sEvent.nSubType == GSLC_EVTSUB_DRAW_NEEDED) && (!pCollect->bElemRefDirtyAll)) {
+    // Only the elements in the dirty list need to be drawn
+    // - Iterate over a copy of the list as drawing an element
+    //   may mark other elements for redraw
+    uint16_t  anElemRefDirty[GSLC_COLLECT_DIRTY_MAX];
+    uint8_t   nDirtyCnt = pCollect->nElemRefDirtyCnt;
+    memcpy(anElemRefDirty,pCollect->anElemRefDirty,nDirtyCnt*sizeof(anElemRefDirty[0]));
+
+    for (nInd=0;nInd<nDirtyCnt;nInd++) {
+      gslc_tsEvent sEventNew = sEvent;
+      sEventNew.pvScope = (void*)(&(pCollect->asElemRef[anElemRefDirty[nInd]]));
+      gslc_ElemEvent(pvGui,sEventNew);
+    } // nInd
+
   } else if ( (sEvent.eType == GSLC_EVT_DRAW) || (sEvent.eType == GSLC_EVT_TICK) ) {
     // DRAW and TICK are propagated down to all elements in collection
 
@@ -5460,6 +6674,11 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
   // Fetch a pointer to the element reference array entry
   gslc_tsElemRef* pElemRef = &(pCollect->asElemRef[nElemRefInd]);
 
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  // Rebuild the hit-test grid on the next touch search
+  pCollect->bTouchGridBuilt = false;
+  #endif
+
   // Mark any newly added element as requiring redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 
@@ -5479,10 +6698,15 @@ bool gslc_CollectGetRedraw(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
   uint16_t        nInd;
   gslc_tsElemRef* pSubElemRef;
   bool            bCollectRedraw = false;
+  uint16_t        nScanCnt = (pCollect->bElemRefDirtyAll)? pCollect->nElemRefCnt : pCollect->nElemRefDirtyCnt;
 
-  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+  for (nInd=0;nInd<nScanCnt;nInd++) {
     // Fetch the element pointer from the reference array
-    pSubElemRef = &(pCollect->asElemRef[nInd]);
+    if (pCollect->bElemRefDirtyAll) {
+      pSubElemRef = &(pCollect->asElemRef[nInd]);
+    } else {
+      pSubElemRef = &(pCollect->asElemRef[pCollect->anElemRefDirty[nInd]]);
+    }
     if (gslc_ElemGetRedraw(pGui,pSubElemRef) != GSLC_REDRAW_NONE) {
       bCollectRedraw = true;
       break;
@@ -5492,6 +6716,63 @@ bool gslc_CollectGetRedraw(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
   return bCollectRedraw;
 }
 
+void gslc_CollectDirtyAdd(gslc_tsCollect* pCollect,uint16_t nElemRefInd)
+{
+  uint8_t nPos;
+  if (pCollect->bElemRefDirtyAll) {
+    // All element references are already being checked
+    return;
+  }
+
+  // Find the sorted insertion point
+  for (nPos=0;nPos<pCollect->nElemRefDirtyCnt;nPos++) {
+    if (pCollect->anElemRefDirty[nPos] == nElemRefInd) {
+      // Already in the list
+      return;
+    } else if (pCollect->anElemRefDirty[nPos] > nElemRefInd) {
+      break;
+    }
+  }
+
+  if (pCollect->nElemRefDirtyCnt >= GSLC_COLLECT_DIRTY_MAX) {
+    // No space left, so revert to checking all element references
+    pCollect->bElemRefDirtyAll = true;
+    return;
+  }
+
+  memmove(&(pCollect->anElemRefDirty[nPos+1]),&(pCollect->anElemRefDirty[nPos]),
+    (pCollect->nElemRefDirtyCnt-nPos)*sizeof(pCollect->anElemRefDirty[0]));
+  pCollect->anElemRefDirty[nPos] = nElemRefInd;
+  pCollect->nElemRefDirtyCnt++;
+}
+
+void gslc_CollectDirtyUpdate(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+  uint16_t  nInd;
+  uint16_t  nElemRefInd;
+  uint8_t   nDirtyCnt = 0;
+  uint16_t  nScanCnt = (pCollect->bElemRefDirtyAll)? pCollect->nElemRefCnt : pCollect->nElemRefDirtyCnt;
+
+  // Keep the elements that still require redraw. As the list
+  // is compacted in place, entries are never overwritten
+  // before they have been read.
+  for (nInd=0;nInd<nScanCnt;nInd++) {
+    nElemRefInd = (pCollect->bElemRefDirtyAll)? nInd : pCollect->anElemRefDirty[nInd];
+    if (gslc_ElemGetRedraw(pGui,&(pCollect->asElemRef[nElemRefInd])) == GSLC_REDRAW_NONE) {
+      continue;
+    }
+    if (nDirtyCnt >= GSLC_COLLECT_DIRTY_MAX) {
+      // Too many remain, so continue to check all element references
+      pCollect->bElemRefDirtyAll = true;
+      pCollect->nElemRefDirtyCnt = 0;
+      return;
+    }
+    pCollect->anElemRefDirty[nDirtyCnt++] = nElemRefInd;
+  }
+  pCollect->nElemRefDirtyCnt = nDirtyCnt;
+  pCollect->bElemRefDirtyAll = false;
+}
+
 // Add an element to the collection associated with the page
 //
 // - Depending on the GSLC_ELEMREF_SRC_* setting, CollectElemAdd()
@@ -5606,6 +6887,9 @@ bool gslc_SetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
   if (!gslc_DrvSetBkgndImage(pGui,sImgRef)) {
     return false;
   }
+  #if (GSLC_FEATURE_ELEM_CACHE)
+  pGui->bBkgndColEn = false;
+  #endif
   gslc_InvalidateRgnScreen(pGui);
   gslc_PageFlipSet(pGui,true);
   return true;
@@ -5616,6 +6900,10 @@ bool gslc_SetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
   if (!gslc_DrvSetBkgndColor(pGui,nCol)) {
     return false;
   }
+  #if (GSLC_FEATURE_ELEM_CACHE)
+  pGui->bBkgndColEn = true;
+  pGui->colBkgnd    = nCol;
+  #endif
   gslc_InvalidateRgnScreen(pGui);
   gslc_PageFlipSet(pGui,true);
   return true;
@@ -5708,6 +6996,9 @@ void gslc_ResetElem(gslc_tsElem* pElem)
   pElem->nTxtMarginX      = 0;
   pElem->nTxtMarginY      = 0;
   pElem->pTxtFont         = NULL;
+  #if (GSLC_FEATURE_TXT_SZ_CACHE)
+  pElem->nTxtSzGen        = 0;
+  #endif
 
   pElem->pXData           = NULL;
   pElem->pfuncXEvent      = NULL; // UNUSED
@@ -5863,6 +7154,11 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
   // Initialize element references
   pCollect->nElemRefMax = nElemRefMax;
   pCollect->nElemRefCnt = 0;
+
+  // The dirty list is only enabled once a page collection
+  // has been redrawn (see gslc_CollectDirtyUpdate)
+  pCollect->nElemRefDirtyCnt = 0;
+  pCollect->bElemRefDirtyAll = true;
   pCollect->asElemRef   = asElemRef;
   for (nInd=0;nInd<nElemMax;nInd++) {
     (pCollect->asElemRef[nInd]).pElem = NULL;
@@ -5871,6 +7167,10 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
   // Reset touch / input tracking
   pCollect->pElemRefTracked = NULL;
   pCollect->nElemIndTracked = GSLC_IND_NONE;
+
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  pCollect->bTouchGridBuilt = false;
+  #endif
 }
 
 
@@ -5929,6 +7229,110 @@ void gslc_CollectSetElemTracked(gslc_tsGui* pGui,gslc_tsCollect* pCollect,gslc_t
   pCollect->nElemIndTracked = nElemInd;
 }
 
+#if (GSLC_FEATURE_TOUCH_GRID)
+// Determine the range of touch grid cells covered by an element
+// - Returns false if the element can't receive touch events or
+//   doesn't overlap the grid
+static bool gslc_CollectTouchGridSpan(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t nInd,
+  int16_t* pnCol0,int16_t* pnCol1,int16_t* pnRow0,int16_t* pnRow1)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nInd]));
+  if (pElem == NULL) { return false; }
+  if (!(pElem->nFeatures & GSLC_ELEM_FEA_CLICK_EN)) { return false; }
+
+  gslc_tsRect rElem = pElem->rElem;
+  if ((rElem.w == 0) || (rElem.h == 0)) { return false; }
+
+  int32_t nX0 = rElem.x;
+  int32_t nY0 = rElem.y;
+  int32_t nX1 = (int32_t)rElem.x + rElem.w - 1;
+  int32_t nY1 = (int32_t)rElem.y + rElem.h - 1;
+  int32_t nGridW = (int32_t)pCollect->nTouchGridCellW * GSLC_TOUCH_GRID_COLS;
+  int32_t nGridH = (int32_t)pCollect->nTouchGridCellH * GSLC_TOUCH_GRID_ROWS;
+  if ((nX1 < 0) || (nY1 < 0) || (nX0 >= nGridW) || (nY0 >= nGridH)) { return false; }
+
+  if (nX0 < 0) { nX0 = 0; }
+  if (nY0 < 0) { nY0 = 0; }
+  if (nX1 >= nGridW) { nX1 = nGridW-1; }
+  if (nY1 >= nGridH) { nY1 = nGridH-1; }
+  *pnCol0 = (int16_t)(nX0 / pCollect->nTouchGridCellW);
+  *pnCol1 = (int16_t)(nX1 / pCollect->nTouchGridCellW);
+  *pnRow0 = (int16_t)(nY0 / pCollect->nTouchGridCellH);
+  *pnRow1 = (int16_t)(nY1 / pCollect->nTouchGridCellH);
+  return true;
+}
+
+// Build the touch hit-test grid for a collection
+// - Each cell lists the clickable elements that overlap it,
+//   in increasing Z-order
+// - If the entries don't fit in the grid pool, the grid is
+//   marked as not usable (zero cell size) until it is rebuilt
+static void gslc_CollectTouchGridBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+  uint16_t* anStart = pCollect->anTouchGridStart;
+  uint16_t  nCellMax = GSLC_TOUCH_GRID_COLS * GSLC_TOUCH_GRID_ROWS;
+  uint16_t  nCell;
+  uint16_t  nInd;
+  uint32_t  nTotal = 0;
+  int16_t   nCol0,nCol1,nRow0,nRow1;
+  int16_t   nCol,nRow;
+
+  pCollect->bTouchGridBuilt = true;
+  pCollect->nTouchGridGen   = pGui->nTouchGridGen;
+  pCollect->nTouchGridCellW = (pGui->nDispW + GSLC_TOUCH_GRID_COLS - 1) / GSLC_TOUCH_GRID_COLS;
+  pCollect->nTouchGridCellH = (pGui->nDispH + GSLC_TOUCH_GRID_ROWS - 1) / GSLC_TOUCH_GRID_ROWS;
+  if ((pCollect->nTouchGridCellW <= 0) || (pCollect->nTouchGridCellH <= 0)) {
+    pCollect->nTouchGridCellW = 0;
+    return;
+  }
+
+  // Count the entries in each cell
+  for (nCell=0;nCell<=nCellMax;nCell++) {
+    anStart[nCell] = 0;
+  }
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    if (!gslc_CollectTouchGridSpan(pGui,pCollect,nInd,&nCol0,&nCol1,&nRow0,&nRow1)) {
+      continue;
+    }
+    for (nRow=nRow0;nRow<=nRow1;nRow++) {
+      for (nCol=nCol0;nCol<=nCol1;nCol++) {
+        anStart[nRow*GSLC_TOUCH_GRID_COLS+nCol]++;
+        nTotal++;
+      }
+    }
+  }
+  if (nTotal > GSLC_TOUCH_GRID_POOL) {
+    #if defined(DBG_LOG)
+    GSLC_DEBUG_PRINT("INFO: Touch grid requires %u entries (max %u), using full search\n",
+      (unsigned)nTotal,(unsigned)GSLC_TOUCH_GRID_POOL);
+    #endif
+    pCollect->nTouchGridCellW = 0;
+    return;
+  }
+
+  // Convert the counts into the end offset of each cell
+  for (nCell=1;nCell<nCellMax;nCell++) {
+    anStart[nCell] += anStart[nCell-1];
+  }
+  anStart[nCellMax] = (uint16_t)nTotal;
+
+  // Fill each cell from its end in decreasing Z-order, which
+  // leaves anStart[] pointing at the start of each cell
+  for (nInd=pCollect->nElemRefCnt;nInd>0;nInd--) {
+    if (!gslc_CollectTouchGridSpan(pGui,pCollect,nInd-1,&nCol0,&nCol1,&nRow0,&nRow1)) {
+      continue;
+    }
+    for (nRow=nRow0;nRow<=nRow1;nRow++) {
+      for (nCol=nCol0;nCol<=nCol1;nCol++) {
+        nCell = nRow*GSLC_TOUCH_GRID_COLS+nCol;
+        anStart[nCell]--;
+        pCollect->anTouchGridInd[anStart[nCell]] = nInd-1;
+      }
+    }
+  }
+}
+#endif // GSLC_FEATURE_TOUCH_GRID
+
 // Find an element index in a collection from a coordinate
 // - Note that the search is in decreasing Z-order (ie. front to back)
 //   so that we effectively find the top-most element that should
@@ -5945,6 +7349,37 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
   *pnElemInd = GSLC_IND_NONE;
 
   if (pCollect->nElemRefCnt == 0) { return NULL; }
+
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  // Rebuild the grid if the elements have changed since it was built
+  if ((!pCollect->bTouchGridBuilt) || (pCollect->nTouchGridGen != pGui->nTouchGridGen)) {
+    gslc_CollectTouchGridBuild(pGui,pCollect);
+  }
+  // Only search the grid cell containing the coordinate
+  // - Coordinates outside of the grid fall back to the full search
+  if ((pCollect->nTouchGridCellW > 0) && (nX >= 0) && (nY >= 0)) {
+    int16_t nCol = nX / pCollect->nTouchGridCellW;
+    int16_t nRow = nY / pCollect->nTouchGridCellH;
+    if ((nCol < GSLC_TOUCH_GRID_COLS) && (nRow < GSLC_TOUCH_GRID_ROWS)) {
+      uint16_t nCell  = nRow*GSLC_TOUCH_GRID_COLS+nCol;
+      uint16_t nEntry;
+      for (nEntry=pCollect->anTouchGridStart[nCell+1];nEntry>pCollect->anTouchGridStart[nCell];nEntry--) {
+        nInd      = pCollect->anTouchGridInd[nEntry-1];
+        pElemRef  = &(pCollect->asElemRef[nInd]);
+        if (!gslc_ElemGetVisible(pGui, pElemRef)) {
+          continue;
+        }
+        if (gslc_ElemOwnsCoord(pGui,pElemRef,nX,nY,true)) {
+          pFoundElemRef = pElemRef;
+          *pnElemInd = nInd;
+          break;
+        }
+      }
+      return pFoundElemRef;
+    }
+  }
+  #endif // GSLC_FEATURE_TOUCH_GRID
+
   for (nInd=pCollect->nElemRefCnt-1;nInd>=0;nInd--) {
     pElemRef  = &(pCollect->asElemRef[nInd]);
 
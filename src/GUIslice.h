@@ -68,6 +68,118 @@ extern "C" {
   #define GSLC_FEATURE_FOCUS_ON_TOUCH 1
 #endif
 
+// Provide default for the maximum number of separate invalidated
+// regions tracked between redraws. Additional regions are merged
+// into the existing ones. A value of 1 reverts to a single
+// bounding rect.
+#if !defined(GSLC_INVALIDATE_RGN_MAX)
+  #define GSLC_INVALIDATE_RGN_MAX 4
+#endif
+
+// Provide default for the maximum number of elements in a page
+// that are tracked as requiring redraw. If more elements are
+// marked, the redraw reverts to checking all elements in the page.
+#if !defined(GSLC_COLLECT_DIRTY_MAX)
+  #define GSLC_COLLECT_DIRTY_MAX 8
+#endif
+
+// Provide default for caching the measured text extent in each element
+// so that aligned text doesn't need to be measured on every redraw.
+// This adds a few bytes to every element, so it is disabled by default
+// on AVR devices.
+#if !defined(GSLC_FEATURE_TXT_SZ_CACHE)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_TXT_SZ_CACHE 0
+  #else
+    #define GSLC_FEATURE_TXT_SZ_CACHE 1
+  #endif
+#endif
+
+// Provide default for the touch hit-test grid. When enabled, each
+// collection maintains a grid of GSLC_TOUCH_GRID_COLS x GSLC_TOUCH_GRID_ROWS
+// cells across the display that lists the clickable elements overlapping
+// each cell, so that a touch only needs to check the elements in one cell.
+// GSLC_TOUCH_GRID_POOL is the total number of cell entries available per
+// collection. If it is exceeded, the collection reverts to checking all
+// of its elements.
+#if !defined(GSLC_FEATURE_TOUCH_GRID)
+  #define GSLC_FEATURE_TOUCH_GRID 0
+#endif
+#if !defined(GSLC_TOUCH_GRID_COLS)
+  #define GSLC_TOUCH_GRID_COLS 4
+#endif
+#if !defined(GSLC_TOUCH_GRID_ROWS)
+  #define GSLC_TOUCH_GRID_ROWS 4
+#endif
+#if !defined(GSLC_TOUCH_GRID_POOL)
+  #define GSLC_TOUCH_GRID_POOL 64
+#endif
+
+// Provide default for the polar direction cache. When enabled, the GUI
+// keeps a table of gslc_sinFX() / gslc_cosFX() results at a fixed angular
+// step that is shared by the gauge elements, so that their segment and
+// tick vertices don't recalculate the trigonometry on every redraw.
+// GSLC_POLAR_CACHE_MAX is the maximum number of entries in the table
+// (ie. the finest step is 360/GSLC_POLAR_CACHE_MAX degrees).
+#if !defined(GSLC_FEATURE_POLAR_CACHE)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_POLAR_CACHE 0
+  #else
+    #define GSLC_FEATURE_POLAR_CACHE 1
+  #endif
+#endif
+#if !defined(GSLC_POLAR_CACHE_MAX)
+  #define GSLC_POLAR_CACHE_MAX 72
+#endif
+
+// Provide default for popup save-under support. When enabled and a
+// buffer has been assigned with gslc_PopupSetSaveBuf(), gslc_PopupShow()
+// captures the display pixels under the popup so that gslc_PopupHide()
+// can restore them instead of redrawing the pages below. This requires
+// a display driver that supports DRV_HAS_READ_RECT.
+#if !defined(GSLC_FEATURE_SAVE_UNDER)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_SAVE_UNDER 0
+  #else
+    #define GSLC_FEATURE_SAVE_UNDER 1
+  #endif
+#endif
+
+// Provide default for the rendered element cache. When enabled and a
+// buffer has been assigned with gslc_ElemCacheSetBuf(), elements marked
+// with gslc_ElemSetCacheEn() have their rendered pixels captured after
+// drawing, so that later redraws with an unchanged style are a single
+// block write. GSLC_ELEM_CACHE_MAX is the maximum number of cached
+// renderings (the normal and glowing states are cached separately).
+// This requires a display driver that supports DRV_HAS_READ_RECT.
+#if !defined(GSLC_FEATURE_ELEM_CACHE)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_ELEM_CACHE 0
+  #else
+    #define GSLC_FEATURE_ELEM_CACHE 1
+  #endif
+#endif
+#if !defined(GSLC_ELEM_CACHE_MAX)
+  #define GSLC_ELEM_CACHE_MAX 16
+#endif
+
+// Provide default for the number of horizontal spans that the
+// filled shape rasterizers (eg. triangles and circles) collect
+// on the stack before passing them to the driver in one call.
+// The minimum is 4.
+#if !defined(GSLC_SPAN_BATCH)
+  #define GSLC_SPAN_BATCH 16
+#endif
+
+// Provide default for the finest angular step (in 1/64 degree) used
+// when gslc_DrawFillGradSector() interpolates the gradient color.
+// The step is otherwise chosen so that adjacent steps differ by about
+// one color level. Larger values reduce the number of wedges drawn at
+// the cost of visible banding.
+#if !defined(GSLC_SECTOR_GRAD_STEP64)
+  #define GSLC_SECTOR_GRAD_STEP64 16
+#endif
+
 // Ensure that touch/input drivers have not been disabled if FEATURE_INPUT has been requested
 // - Either use DRV_TOUCH_INPUT if no touch-screen is used (but external pins are being used)
 // - Or select a DRV_TOUCH_* driver specific to the touch-screen device
@@ -187,6 +299,7 @@ typedef enum {
 } gslc_teTypeCore;
 
 /// Element features type
+#define GSLC_ELEM_FEA_CACHE_EN  0x0200      ///< Element rendering is cached (see gslc_ElemSetCacheEn)
 #define GSLC_ELEM_FEA_NOSHRINK  0x0100      ///< Element can't be shrunk (eg. contains image)
 #define GSLC_ELEM_FEA_VALID     0x0080      ///< Element record is valid
 #define GSLC_ELEM_FEA_FOCUS_EN  0x0040      ///< Element can accept focus
@@ -475,12 +588,32 @@ typedef enum {
   GSLC_IMGREF_FMT_BMP16   = (2<<4),   ///< Image format is BMP (16-bit RGB565)
   GSLC_IMGREF_FMT_RAW1    = (3<<4),   ///< Image format is raw monochrome (1-bit)
   GSLC_IMGREF_FMT_JPG     = (4<<4),   ///< Image format is JPG (ESP32/ESP8366)
+  GSLC_IMGREF_FMT_RLE16   = (5<<4),   ///< Image format is run-length encoded RGB565
 
   // Mask values for bitfield comparisons
   GSLC_IMGREF_SRC         = (7<<0),   ///< Mask for Source flags
   GSLC_IMGREF_FMT         = (7<<4),   ///< Mask for Format flags
 } gslc_teImgRefFlags;
 
+/// \defgroup _RLE16_ Run-length encoded RGB565 image format (GSLC_IMGREF_FMT_RLE16)
+/// The image is an array of 16-bit words:
+/// - Height, Width
+/// - A sequence of runs for each row in turn. Runs do not cross rows.
+///   Each run starts with a word that holds the operation in
+///   bits [15:14] and the pixel count (1..16383) in bits [13:0]:
+///   - COPY: the RGB565 pixels follow
+///   - FILL: a single RGB565 pixel follows and is repeated
+///   - SKIP: the pixels are transparent and are not drawn
+///
+/// Images can be created from 24-bit BMP files with tools/bmp2rle.c
+/// @{
+#define GSLC_RLE16_OP_MASK    0xC000  ///< Mask for the run operation
+#define GSLC_RLE16_OP_COPY    0x0000  ///< Run of pixels stored individually
+#define GSLC_RLE16_OP_FILL    0x4000  ///< Run of a single repeated pixel
+#define GSLC_RLE16_OP_SKIP    0x8000  ///< Run of transparent pixels
+#define GSLC_RLE16_CNT_MASK   0x3FFF  ///< Mask for the run pixel count
+/// @}
+
 /// Text reference flags: Describes the characteristics of a text string
 /// (ie. whether internal to element or external and RAM vs Flash).)
 ///
@@ -539,6 +672,13 @@ typedef bool (*GSLC_CB_PIN_POLL)(void* pvGui,int16_t* pnPinInd,int16_t* pnPinVal
 /// Callback function for element input ready
 typedef bool (*GSLC_CB_INPUT)(void* pvGui,void* pvElemRef,int16_t nStatus,void* pvData);
 
+/// Callback function for reading from an image file
+/// - Returns the number of bytes read, or negative on error
+typedef int32_t (*GSLC_CB_FILE_READ)(void* pvFile,uint8_t* pBuf,uint16_t nLen);
+
+/// Callback function for seeking to an absolute position in an image file
+typedef bool (*GSLC_CB_FILE_SEEK)(void* pvFile,uint32_t nPos);
+
 // -----------------------------------------------------------------------
 // Structures
 // -----------------------------------------------------------------------
@@ -559,6 +699,26 @@ typedef struct gslc_tsPt {
   int16_t   y;        ///< Y coordinate
 } gslc_tsPt;
 
+/// Define a horizontal span of pixels within a single row
+/// - Both endpoints are inclusive
+typedef struct gslc_tsSpan {
+  int16_t   y;        ///< Y coordinate of row
+  int16_t   x0;       ///< X coordinate of left endpoint
+  int16_t   x1;       ///< X coordinate of right endpoint
+} gslc_tsSpan;
+
+#if (GSLC_FEATURE_POLAR_CACHE)
+/// Polar direction cache
+/// - Holds gslc_sinFX() and gslc_cosFX() for each multiple of nStep64
+///   in a full circle
+typedef struct gslc_tsPolarCache {
+  int16_t   nStep64;                      ///< Angle between entries (in units of 1/64 degrees), 0 if empty
+  uint16_t  nNumEnt;                      ///< Number of entries in use
+  int16_t   anSin[GSLC_POLAR_CACHE_MAX];  ///< Sine of each entry's angle
+  int16_t   anCos[GSLC_POLAR_CACHE_MAX];  ///< Cosine of each entry's angle
+} gslc_tsPolarCache;
+#endif // GSLC_FEATURE_POLAR_CACHE
+
 /// Color structure. Defines RGB triplet.
 typedef struct gslc_tsColor {
   uint8_t r;      ///< RGB red value
@@ -620,6 +780,30 @@ typedef struct {
   void*                 pvImgRaw;   ///< Ptr to raw output image data (for pre-loaded images)
 } gslc_tsImgRef;
 
+/// Streaming reader for uncompressed 24-bit or 32-bit BMP files
+/// - File access is performed through callbacks so that the same
+///   reader can be used with SD card libraries or a regular file
+/// - As many whole rows as fit in the buffer are read at once
+typedef struct {
+  void*                 pvFile;     ///< File handle passed to the callbacks
+  GSLC_CB_FILE_READ     pfuncRead;  ///< Callback to read from the file
+  GSLC_CB_FILE_SEEK     pfuncSeek;  ///< Callback to seek within the file
+  uint8_t*              pBuf;       ///< Buffer for the file data
+  uint16_t              nBufLen;    ///< Size of the buffer (in bytes)
+  int16_t               nImgW;      ///< Image width (in pixels)
+  int16_t               nImgH;      ///< Image height (in pixels)
+  uint8_t               nPixBytes;  ///< Bytes per pixel in the file (3 or 4)
+  bool                  bFlip;      ///< Rows are stored bottom-to-top
+  uint32_t              nDataPos;   ///< File position of the pixel data
+  uint32_t              nRowSize;   ///< Bytes per row (including padding)
+  uint32_t              nFilePos;   ///< Current file position
+  gslc_tsRect           rRegion;    ///< Region of the image to read
+  int16_t               nRow;       ///< Next row to read
+  int16_t               nCol;       ///< Next column to read (when rows are read in pieces)
+  int16_t               nBufRow0;   ///< First row held in the buffer
+  int16_t               nBufRows;   ///< Number of rows held in the buffer
+} gslc_tsBmpStream;
+
 
 /// Element reference structure
 typedef struct {
@@ -691,6 +875,18 @@ typedef struct gslc_tsElem {
   GSLC_CB_DRAW        pfuncXDraw;       ///< Callback func ptr for custom drawing
   GSLC_CB_TOUCH       pfuncXTouch;      ///< Callback func ptr for touch
   GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick
+
+#if (GSLC_FEATURE_TXT_SZ_CACHE)
+  // Cached text extent
+  // - Only maintained for elements stored in RAM
+  // - Left zero (ie. not measured) by the ElemCreate*_P() macros
+  int16_t             nTxtSzOffsetX;    ///< Cached text offset X (from gslc_DrvGetTxtSize)
+  int16_t             nTxtSzOffsetY;    ///< Cached text offset Y (from gslc_DrvGetTxtSize)
+  uint16_t            nTxtSzW;          ///< Cached text width
+  uint16_t            nTxtSzH;          ///< Cached text height
+  uint16_t            nTxtSzHash;       ///< Hash of the text string and encoding that was measured
+  uint8_t             nTxtSzGen;        ///< Value of gslc_tsGui::nTxtSzGen when measured (0 if not measured)
+#endif
 } gslc_tsElem;
 
 
@@ -716,6 +912,23 @@ typedef struct {
   gslc_tsElemRef*       pElemRefTracked;  ///< Element reference currently being touch-tracked (NULL for none)
   int16_t               nElemIndTracked;  ///< Element index currently being touch-tracked (GSLC_IND_NONE for none)
 
+  // Redraw tracking
+  // - Only maintained for page collections
+  uint16_t              anElemRefDirty[GSLC_COLLECT_DIRTY_MAX]; ///< Sorted indices of element references marked for redraw
+  uint8_t               nElemRefDirtyCnt; ///< Number of entries in anElemRefDirty
+  bool                  bElemRefDirtyAll; ///< Dirty list is incomplete, so all element references must be checked
+
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  // Touch hit-test grid
+  // - Built on demand by gslc_CollectFindElemFromCoord()
+  uint16_t              anTouchGridStart[GSLC_TOUCH_GRID_COLS*GSLC_TOUCH_GRID_ROWS+1]; ///< Offset of each cell's entries in anTouchGridInd
+  uint16_t              anTouchGridInd[GSLC_TOUCH_GRID_POOL]; ///< Element reference indices per cell (in increasing Z-order)
+  int16_t               nTouchGridCellW;  ///< Width of a grid cell (0 if grid not usable)
+  int16_t               nTouchGridCellH;  ///< Height of a grid cell (0 if grid not usable)
+  uint16_t              nTouchGridGen;    ///< Value of gslc_tsGui::nTouchGridGen when the grid was built
+  bool                  bTouchGridBuilt;  ///< The grid has been built
+  #endif
+
   // Callback functions
   //GSLC_CB_EVENT         pfuncXEvent;      ///< UNUSED: Callback func ptr for events
 
@@ -742,6 +955,20 @@ typedef struct {
 
 } gslc_tsPage;
 
+#if (GSLC_FEATURE_ELEM_CACHE)
+/// Rendered element cache entry
+/// - Holds the location of an element's captured pixels within
+///   the buffer assigned by gslc_ElemCacheSetBuf()
+typedef struct {
+  gslc_tsElemRef*     pElemRef;         ///< Element that was captured (NULL if unused)
+  bool                bGlow;            ///< Element was captured in the glowing state
+  uint32_t            nHash;            ///< Hash of the element style when captured
+  gslc_tsRect         rCache;           ///< Region of the display that was captured
+  uint32_t            nBufOfs;          ///< Offset of the pixels within the cache buffer
+  uint32_t            nBufLen;          ///< Space reserved for the pixels (in bytes)
+} gslc_tsElemCache;
+#endif // GSLC_FEATURE_ELEM_CACHE
+
 
 /// Input mapping
 /// - Describes mapping from keyboard or GPIO input
@@ -846,7 +1073,44 @@ typedef struct {
 
   // Current clip region
   bool                bInvalidateEn;     ///< A region of the display has been invalidated
-  gslc_tsRect         rInvalidateRect;   ///< The rect region that has been invalidated
+  uint8_t             nInvalidateRectCnt; ///< Number of invalidated rect regions
+  gslc_tsRect         asInvalidateRect[GSLC_INVALIDATE_RGN_MAX]; ///< The rect regions that have been invalidated
+  bool                abInvalidateRectFull[GSLC_INVALIDATE_RGN_MAX]; ///< Region requires background and all overlapping elements to be redrawn
+  bool                bRedrawRgnEn;      ///< Page redraw is limited to rRedrawRgn
+  gslc_tsRect         rRedrawRgn;        ///< The invalidated region currently being redrawn
+
+  #if (GSLC_FEATURE_TOUCH_GRID)
+  uint16_t            nTouchGridGen;     ///< Incremented whenever element touch areas change
+  #endif
+
+  #if (GSLC_FEATURE_TXT_SZ_CACHE)
+  uint8_t             nTxtSzGen;         ///< Incremented whenever fonts change (never 0)
+  #endif
+
+  #if (GSLC_FEATURE_POLAR_CACHE)
+  gslc_tsPolarCache   sPolarCache;       ///< Shared sine/cosine table for gauge vertices
+  #endif
+
+  #if (GSLC_FEATURE_SAVE_UNDER)
+  uint8_t*            pSaveBuf;          ///< Buffer for the pixels under a popup (or NULL)
+  uint32_t            nSaveBufLen;       ///< Size of pSaveBuf (in bytes)
+  bool                bSavePend;         ///< Capture rSave when the popup is next drawn
+  bool                bSaveValid;        ///< pSaveBuf holds the pixels under rSave
+  gslc_tsRect         rSave;             ///< Region of the display saved under the popup
+  bool                bSaveDirty;        ///< Pages below the popup have drawn within rSave
+  gslc_tsRect         rSaveDirty;        ///< Bounds of the drawing within rSave since capture
+  bool                bSaveDirtyFull;    ///< The background has been drawn within rSaveDirty
+  uint8_t             nRedrawStack;      ///< Page stack position currently being redrawn
+  #endif
+
+  #if (GSLC_FEATURE_ELEM_CACHE)
+  uint8_t*            pElemCacheBuf;     ///< Buffer for rendered element pixels (or NULL)
+  uint32_t            nElemCacheBufLen;  ///< Size of pElemCacheBuf (in bytes)
+  uint32_t            nElemCacheBufNext; ///< Offset within pElemCacheBuf for the next capture
+  gslc_tsElemCache    asElemCache[GSLC_ELEM_CACHE_MAX]; ///< Rendered element cache entries
+  bool                bBkgndColEn;       ///< Background is the solid color set by gslc_SetBkgndColor()
+  gslc_tsColor        colBkgnd;          ///< Background color (if bBkgndColEn)
+  #endif
 
   // Callback functions
   //GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for events
@@ -1133,6 +1397,16 @@ gslc_tsRect gslc_ExpandRect(gslc_tsRect rRect,int16_t nExpandW,int16_t nExpandH)
 ///
 bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight);
 
+///
+/// Determine if two rectangular regions overlap
+///
+/// \param[in]  rRect1:      First rectangular region
+/// \param[in]  rRect2:      Second rectangular region
+///
+/// \return true if the regions share at least one pixel, false otherwise
+///
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2);
+
 ///
 /// Expand a rect to include another rect
 /// - This routine can be useful to modify an invalidation region to
@@ -1176,6 +1450,11 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui);
 ///
 /// Add a rectangular region to the invalidation region
 /// - This is usually called when an element has been modified
+/// - The invalidation region is kept as a list of up to
+///   GSLC_INVALIDATE_RGN_MAX rects. The new rect is merged with
+///   any existing rect where the merged area does not exceed
+///   the sum of the separate areas. If the list is full, the
+///   new rect is merged with the rect that grows the least.
 ///
 /// \param[in]  pGui:     Pointer to GUI
 /// \param[in]  rAddRect: Rectangle to add to the invalidation region
@@ -1266,6 +1545,56 @@ gslc_tsImgRef gslc_GetImageFromRam(unsigned char* pImgBuf,gslc_teImgRefFlags eFm
 gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFlags eFmt);
 
 
+///
+/// Open a streaming reader on an uncompressed 24-bit or 32-bit BMP file
+/// - The file header is parsed and the read region is set to the
+///   whole image
+/// - A buffer that holds several whole rows reduces the number of
+///   reads and seeks (particularly for bottom-to-top BMP files)
+///
+/// \param[in]   pStream      Pointer to stream
+/// \param[in]   pvFile       File handle passed to the callbacks
+/// \param[in]   pfuncRead    Callback to read from the file
+/// \param[in]   pfuncSeek    Callback to seek within the file
+/// \param[in]   pBuf         Buffer for the file data (at least 54 bytes)
+/// \param[in]   nBufLen      Size of the buffer (in bytes)
+///
+/// \return true if the BMP format is supported, false otherwise
+///
+bool gslc_BmpStreamOpen(gslc_tsBmpStream* pStream,void* pvFile,GSLC_CB_FILE_READ pfuncRead,
+  GSLC_CB_FILE_SEEK pfuncSeek,uint8_t* pBuf,uint16_t nBufLen);
+
+
+///
+/// Restrict a BMP stream to a region of the image
+/// - Rows outside of the region are never read
+///
+/// \param[in]   pStream      Pointer to stream
+/// \param[in]   rRegion      Region to read (in image coordinates)
+///
+/// \return true if the region overlaps the image, false otherwise
+///
+bool gslc_BmpStreamSetRegion(gslc_tsBmpStream* pStream,gslc_tsRect rRegion);
+
+
+///
+/// Read the next run of pixels from a BMP stream
+/// - Rows are returned from top to bottom, and a run never
+///   crosses a row
+/// - Pixels are returned in file order (B,G,R or B,G,R,A) with
+///   pStream->nPixBytes bytes per pixel
+/// - The returned pointer is valid until the next read
+///
+/// \param[in]   pStream      Pointer to stream
+/// \param[out]  pnX:         Column of the first pixel (in image coordinates)
+/// \param[out]  pnY:         Row of the pixels (in image coordinates)
+/// \param[out]  ppPix:       Pointer to the first pixel
+///
+/// \return Number of pixels in the run, or 0 at the end of the region or on error
+///
+uint16_t gslc_BmpStreamRead(gslc_tsBmpStream* pStream,int16_t* pnX,int16_t* pnY,const uint8_t** ppPix);
+
+
 
 
 ///
@@ -1281,6 +1610,55 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY);
 
 
+///
+/// Request that the polar direction cache covers a given angular step
+/// - Intended to be called when an element is created or its quality
+///   or tick settings change, rather than during redraw
+/// - The cache is shared by all elements. If it already holds a step
+///   that divides nStep64, it is left unchanged. Otherwise the table is
+///   rebuilt at the common divisor of both steps, provided that it fits
+///   within GSLC_POLAR_CACHE_MAX entries.
+/// - Angles that are not covered by the cache are calculated directly
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nStep64:     Angular step (in units of 1/64 degrees)
+///
+/// \return none
+///
+void gslc_PolarCacheAdd(gslc_tsGui* pGui,int16_t nStep64);
+
+
+///
+/// Fetch the fixed-point sine and cosine of an angle, using the polar
+/// direction cache when the angle is covered by it
+/// - The results are the same as gslc_sinFX() and gslc_cosFX()
+///
+/// \param[in]   pGui         Pointer to GUI
+/// \param[in]   n64Ang       Angle (in units of 1/64 degrees, 0 is up)
+/// \param[out]  pnSin        Fixed-point sine result
+/// \param[out]  pnCos        Fixed-point cosine result
+///
+/// \return none
+///
+void gslc_PolarSinCos(gslc_tsGui* pGui,int32_t n64Ang,int16_t* pnSin,int16_t* pnCos);
+
+
+///
+/// Convert polar coordinate to cartesian, using the polar direction
+/// cache when the angle is covered by it
+/// - The results are the same as gslc_PolarToXY()
+///
+/// \param[in]   pGui         Pointer to GUI
+/// \param[in]   nRad         Radius of ray
+/// \param[in]   n64Ang       Angle of ray (in units of 1/64 degrees, 0 is up)
+/// \param[out]  nDX          X offset for ray end
+/// \param[out]  nDY          Y offset for ray end
+///
+/// \return none
+///
+void gslc_PolarToXYCache(gslc_tsGui* pGui,uint16_t nRad,int32_t n64Ang,int16_t* nDX,int16_t* nDY);
+
+
 ///
 /// Calculate fixed-point sine function from fractional degrees
 /// - Depending on configuration, the result is derived from either
@@ -1387,6 +1765,41 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
 
+///
+/// Draw a series of connected lines (polyline)
+/// - Each point is joined to the next, so nNumPt points
+///   produce (nNumPt-1) line segments
+/// - A closed shape can be drawn by repeating the first
+///   point at the end of the array
+/// - A single point is drawn as a pixel
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to connect
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nCol:        Color RGB value for the lines
+///
+/// \return none
+///
+void gslc_DrawPolyline(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+
+///
+/// Fill a series of horizontal spans with a single color
+/// - This is used by the filled shape rasterizers so that
+///   the rows of a shape can be passed to the driver in
+///   one call rather than one line draw per row
+/// - Each span must have x0 <= x1
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans to fill
+/// \param[in]  nNumSpan:    Number of spans in array
+/// \param[in]  nCol:        Color RGB value for the fill
+///
+/// \return none
+///
+void gslc_DrawFillSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol);
+
+
 ///
 /// Draw a horizontal line
 /// - Note that direction of line is in +ve X axis
@@ -1575,13 +1988,17 @@ void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
 ///   a gradient angular range (nAngGradStart..nAngGradStart+nAngGradRange). This gradient angular
 ///   range can be differeng from the drawing angular range (nAngSegStart..nAngSecEnd) to enable
 ///   more advanced control styling / updates.
+/// - The sector is filled row by row between the two radii, so the arcs are
+///   exact and adjacent sectors sharing an angle neither overlap nor leave a seam
 ///
 /// \param[in]  pGui:          Pointer to GUI
 /// \param[in]  nQuality:      Number of segments used to depict a full circle.
-///                            The higher the value, the smoother the resulting
-///                            arcs. A value of 72 provides 360/72=5 degrees per
-///                            segment which is a reasonable compromise between
-///                            smoothness and performance. Note that 360/nQuality
+///                            The sector angles are rounded to a segment boundary.
+///                            The gradient color is interpolated by angle within
+///                            the sector in steps of about one color level (see
+///                            GSLC_SECTOR_GRAD_STEP64), and is not limited to one
+///                            color per segment. A value of 72 provides 360/72=5
+///                            degrees per segment. Note that 360/nQuality
 ///                            should be an integer result, thus the allowable
 ///                            quality settings are: 360 (max quality), 180, 120,
 ///                            90, 72, 60, 45, 40, 36 (low quality), etc. 
@@ -1604,14 +2021,15 @@ void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
 ///
 /// Draw a flat filled sector of a circle with support for inner and outer radius
 /// - Can be used to create a ring or pie chart
-///
+/// - The sector is filled row by row between the two radii, so the arcs are
+///   exact and adjacent sectors sharing an angle neither overlap nor leave a seam
 ///
 /// \param[in]  pGui:          Pointer to GUI
 /// \param[in]  nQuality:      Number of segments used to depict a full circle.
-///                            The higher the value, the smoother the resulting
-///                            arcs. A value of 72 provides 360/72=5 degrees per
-///                            segment which is a reasonable compromise between
-///                            smoothness and performance.
+///                            The sector angles are rounded to a segment boundary,
+///                            so the higher the value, the finer the steps of
+///                            the sector ends. A value of 72 provides 360/72=5
+///                            degrees per segment.
 /// \param[in]  nMidX:         Midpoint X coordinate of circle
 /// \param[in]  nMidY:         Midpoint Y coordinate of circle
 /// \param[in]  nRad1:         Inner sector radius (0 for sector / pie, non-zero for ring)
@@ -1803,6 +2221,28 @@ void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal);
 void gslc_PopupHide(gslc_tsGui* pGui);
 
 
+///
+/// Assign a save-under buffer for popup dialogs
+/// - When a popup is shown, the pixels under its page bounds are
+///   captured into the buffer. When it is hidden, they are written
+///   back in a single block and only the areas that were redrawn
+///   by the pages below while the popup was open are redrawn again.
+/// - The buffer must hold the popup region in the display driver's
+///   native pixel format (see gslc_DrvReadRectLen()). If the popup
+///   doesn't fit, or the driver doesn't support DRV_HAS_READ_RECT,
+///   the pages below are redrawn on hide as usual.
+/// - The buffer should be aligned for 16-bit access
+/// - Requires partial redraw support and GSLC_FEATURE_SAVE_UNDER
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pBuf:        Pointer to buffer (or NULL to disable)
+/// \param[in]  nBufLen:     Size of the buffer (in bytes)
+///
+/// \return true if success, false if save-under is not supported
+///
+bool gslc_PopupSetSaveBuf(gslc_tsGui* pGui, uint8_t* pBuf, uint32_t nBufLen);
+
+
 ///
 /// Update the need-redraw status for the current page
 ///
@@ -2033,6 +2473,46 @@ void gslc_ElemSetFillEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bFillEn);
 ///
 void gslc_ElemSetFrameEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bFrameEn);
 
+///
+/// Set the rendering cache state for an Element
+/// - When enabled, the element's pixels are captured after it is drawn
+///   and later redraws write them back in a single block for as long
+///   as the element's style, text and state are unchanged
+/// - Only filled elements without a custom draw function are cached,
+///   as their pixels don't depend on what is behind them
+/// - Rounded elements are only cached when the corners show a known
+///   solid color: the fill of a plain parent element, or else the
+///   color set by gslc_SetBkgndColor(). They must not overlap other
+///   elements, as any change to those wouldn't be seen in the corners.
+/// - Requires a buffer assigned by gslc_ElemCacheSetBuf()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  bCacheEn:    True if cached, false otherwise
+///
+/// \return none
+///
+void gslc_ElemSetCacheEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bCacheEn);
+
+///
+/// Assign the buffer for the rendered element cache
+/// - The size of the buffer sets the memory budget for the cache. When
+///   it is full, the oldest renderings are replaced.
+/// - Each rendering occupies gslc_DrvReadRectLen() bytes for the
+///   element's region. The normal and glowing states are held separately.
+/// - On devices with external RAM (eg. ESP32 PSRAM) the buffer can be
+///   allocated there
+/// - The buffer should be aligned for 32-bit access
+/// - Requires GSLC_FEATURE_ELEM_CACHE
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pBuf:        Pointer to buffer (or NULL to disable)
+/// \param[in]  nBufLen:     Size of the buffer (in bytes)
+///
+/// \return true if success, false if the cache is not supported
+///
+bool gslc_ElemCacheSetBuf(gslc_tsGui* pGui,uint8_t* pBuf,uint32_t nBufLen);
+
 ///
 /// Set the rounded frame/fill state for an Element
 ///
@@ -3742,8 +4222,10 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId);
 /// Perform a redraw calculation on the page to determine if additional
 /// elements should also be redrawn. This routine checks to see if any
 /// transparent elements have been marked as needing redraw. If so, the
-/// whole page may be marked as needing redraw (or at least the other
-/// elements that have been exposed underneath).
+/// invalidated regions they overlap are marked for a full redraw of the
+/// background and all elements underneath. The whole page is marked as
+/// needing redraw only if partial redraw is disabled or no invalidated
+/// region has been defined.
 ///
 /// \param[in]  pGui:         Pointer to GUI
 ///
@@ -3858,6 +4340,35 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
 bool gslc_CollectGetRedraw(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 
 
+///
+/// Record that an element in a collection has been marked for redraw
+/// - The dirty list is kept sorted so that elements are drawn in
+///   their stacking order
+/// - If the dirty list is full, the collection reverts to checking
+///   all element references
+///
+/// \param[in]  pCollect:     Pointer to Element collection
+/// \param[in]  nElemRefInd:  Index of the element reference
+///
+/// \return none
+///
+void gslc_CollectDirtyAdd(gslc_tsCollect* pCollect,uint16_t nElemRefInd);
+
+
+///
+/// Update the dirty list of a collection after a redraw
+/// - Entries for elements that no longer require redraw are removed
+/// - If all element references were being checked, the dirty list
+///   is rebuilt from the remaining elements that require redraw
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to Element collection
+///
+/// \return none
+///
+void gslc_CollectDirtyUpdate(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
+
+
 /// Find an element in a collection by its Element ID
 ///
 /// \param[in]  pGui:         Pointer to GUI
@@ -3874,6 +4385,11 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
 /// - A match is found if the element is "clickable" (bClickEn=true)
 ///   and the coordinate falls within the element's bounds (rElem).
 ///
+/// - If GSLC_FEATURE_TOUCH_GRID is enabled, only the elements listed
+///   in the grid cell containing the coordinate are checked. The grid
+///   is rebuilt on demand after elements have been added, moved or
+///   had their click status changed.
+///
 /// \param[in]  pGui:         Pointer to GUI
 /// \param[in]  pCollect:     Pointer to the collection
 /// \param[in]  nX:           Absolute X coordinate to use for search
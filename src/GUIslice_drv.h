@@ -45,6 +45,8 @@ extern "C" {
   #include "GUIslice_drv_sdl.h"
 #elif defined(DRV_DISP_SDL2)
   #include "GUIslice_drv_sdl.h"
+#elif defined(DRV_DISP_MEMFB)
+  #include "GUIslice_drv_memfb.h"
 #elif defined(DRV_DISP_ADAGFX) || defined(DRV_DISP_ADAGFX_AS)
   #include "GUIslice_drv_adagfx.h"
 #elif defined(DRV_DISP_TFT_ESPI)
@@ -55,6 +55,18 @@
     // No need to import Adafruit_GFX
   #else
     #include <Adafruit_GFX.h>
+    #if !defined(DRV_DISP_LCDGFX) && !defined(DRV_DISP_ADAGFX_RA8875_SUMO) && !defined(DRV_DISP_ADAGFX_ILI9341_DUE_MB)
+      // Display is derived from Adafruit_GFX, which supports grouping
+      // several drawing operations in one bus transaction with
+      // startWrite() / endWrite()
+      #define DRV_ADAGFX_WRITE_EN
+      #if defined(DRV_DISP_ADAGFX_ILI9341) || defined(DRV_DISP_ADAGFX_ST7735) || defined(DRV_DISP_ADAGFX_HX8357)
+        // Display is derived from Adafruit_SPITFT, which supports
+        // streaming a block of pixels into an address window with
+        // setAddrWindow() / writePixels()
+        #define DRV_ADAGFX_BLIT_EN
+      #endif
+    #endif
   #endif
 
   // Now configure specific display driver for Adafruit-GFX
@@ -488,6 +500,84 @@ extern "C" {
 // ------------------------------------------------------------------------
 #endif // DRV_DISP_ADAGFX_*
 
+// ------------------------------------------------------------------------
+// Bus transaction grouping
+// - Between gslc_DrvRedrawBegin() and gslc_DrvRedrawEnd() a single bus
+//   transaction is held open and the primitives use the write*() APIs
+// - Display APIs that manage their own transaction (and any access to
+//   another device on a shared bus) must be bracketed by
+//   gslc_DrvWriteSuspend() and gslc_DrvWriteResume()
+// - The redraw transaction is only opened by the first write that
+//   needs it (gslc_DrvWriteOpen()), so that text and the other APIs
+//   that manage their own transaction don't add transactions
+
+#if defined(DRV_ADAGFX_WRITE_EN)
+  static bool m_bRedrawWrite = false; // Redraw transaction is open
+  static bool m_bRedrawPend  = false; // Redraw transaction to be opened by the next write
+#endif
+
+// Open the redraw transaction if it is pending
+// - Returns true if the write*() APIs may be used
+inline bool gslc_DrvWriteOpen()
+{
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  if (m_bRedrawPend) {
+    m_disp.startWrite();
+    m_bRedrawWrite = true;
+    m_bRedrawPend  = false;
+  }
+  return m_bRedrawWrite;
+  #else
+  return false;
+  #endif
+}
+
+// Open a transaction for a group of write*() calls
+inline void gslc_DrvWriteBegin()
+{
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  if (!gslc_DrvWriteOpen()) { m_disp.startWrite(); }
+  #endif
+}
+
+// Close a transaction opened by gslc_DrvWriteBegin()
+inline void gslc_DrvWriteEnd()
+{
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  if (!m_bRedrawWrite) { m_disp.endWrite(); }
+  #endif
+}
+
+// Temporarily close the redraw transaction
+// - Returns true if gslc_DrvWriteResume() needs to reopen it
+inline bool gslc_DrvWriteSuspend()
+{
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  bool bRedraw = (m_bRedrawWrite || m_bRedrawPend);
+  if (m_bRedrawWrite) {
+    m_disp.endWrite();
+    m_bRedrawWrite = false;
+  }
+  m_bRedrawPend = false;
+  return bRedraw;
+  #else
+  return false;
+  #endif
+}
+
+// Reopen a redraw transaction closed by gslc_DrvWriteSuspend()
+// - The transaction is reopened by the next write
+inline void gslc_DrvWriteResume(bool bSuspended)
+{
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  if (bSuspended) {
+    m_bRedrawPend = true;
+  }
+  #else
+  (void)bSuspended; // Unused
+  #endif
+}
+
 
 
 // ------------------------------------------------------------------------
@@ -1232,6 +1322,9 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   uint16_t  nColRaw = gslc_DrvAdaptColorToRaw(colTxt);
   char      ch;
 
+  // Character rendering manages its own bus transaction
+  bool      bSuspended = gslc_DrvWriteSuspend();
+
   // Initialize the font and positioning
 #if defined(DRV_DISP_ADAGFX_ILI9341_T3) || defined(DRV_DISP_ADAGFX_ILI9341_T3N)
   (void)pGui; // Unused
@@ -1507,6 +1600,7 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   m_disp.setFont();
 #endif
 
+  gslc_DrvWriteResume(bSuspended);
   return true;
 }
 
@@ -1514,6 +1608,30 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 // Screen Management Functions
 // -----------------------------------------------------------------------
 
+void gslc_DrvRedrawBegin(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  // Keep the display selected for the entire redraw, from the
+  // first write onwards
+  if (!m_bRedrawWrite) {
+    m_bRedrawPend = true;
+  }
+  #endif
+}
+
+void gslc_DrvRedrawEnd(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  if (m_bRedrawWrite) {
+    m_disp.endWrite();
+    m_bRedrawWrite = false;
+  }
+  m_bRedrawPend = false;
+  #endif
+}
+
 void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 {
   (void)pGui; // Unused
@@ -1542,6 +1660,12 @@ inline void gslc_DrvDrawPoint_base(int16_t nX, int16_t nY, uint16_t nColRaw)
     p.setPoint(nX, nY);
     m_disp.setColor(nColRaw);
     m_disp.putPixel(nX,nY);
+  #elif defined(DRV_ADAGFX_WRITE_EN)
+    if (gslc_DrvWriteOpen()) {
+      m_disp.writePixel(nX,nY,nColRaw);
+    } else {
+      m_disp.drawPixel(nX,nY,nColRaw);
+    }
   #else
     m_disp.drawPixel(nX,nY,nColRaw);
   #endif
@@ -1552,9 +1676,22 @@ inline void gslc_DrvDrawLine_base(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY
   #if defined(DRV_DISP_LCDGFX)
     m_disp.setColor(nColRaw);
     m_disp.drawLine(nX0,nY0,nX1,nY1);
+  #elif defined(DRV_ADAGFX_WRITE_EN)
+    if (!gslc_DrvWriteOpen()) {
+      m_disp.drawLine(nX0,nY0,nX1,nY1,nColRaw);
+    } else if (nY0 == nY1) {
+      // Same dispatch as drawLine() but within the open transaction
+      if (nX0 > nX1) { int16_t nTmp = nX0; nX0 = nX1; nX1 = nTmp; }
+      m_disp.writeFastHLine(nX0,nY0,nX1-nX0+1,nColRaw);
+    } else if (nX0 == nX1) {
+      if (nY0 > nY1) { int16_t nTmp = nY0; nY0 = nY1; nY1 = nTmp; }
+      m_disp.writeFastVLine(nX0,nY0,nY1-nY0+1,nColRaw);
+    } else {
+      m_disp.writeLine(nX0,nY0,nX1,nY1,nColRaw);
+    }
   #else
     m_disp.drawLine(nX0,nY0,nX1,nY1,nColRaw);
-  #endif	
+  #endif
 }
 
 
@@ -1572,13 +1709,92 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 }
 
 
+// Output a horizontal run of adjacent points collected by gslc_DrvDrawPoints()
+inline void gslc_DrvDrawPointRun_base(int16_t nX0,int16_t nX1,int16_t nY,uint16_t nColRaw)
+{
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  if (nX0 == nX1) {
+    m_disp.writePixel(nX0,nY,nColRaw);
+  } else {
+    // A single address window covers the whole run
+    m_disp.writeFastHLine(nX0,nY,nX1-nX0+1,nColRaw);
+  }
+  #else
+  if (nX0 == nX1) {
+    gslc_DrvDrawPoint_base(nX0,nY,nColRaw);
+  } else {
+    gslc_DrvDrawLine_base(nX0,nY,nX1,nY,nColRaw);
+  }
+  #endif
+}
+
 bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
 {
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#else
   (void)pGui; // Unused
-  (void)asPt; // Unused
-  (void)nNumPt; // Unused
-  (void)nCol; // Unused
-  return false;
+#endif
+
+  // Only perform the color conversion once for all points
+  uint16_t  nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  gslc_tsPt asSort[DRV_ADAGFX_POINTS_SORT];
+  gslc_tsPt sPt;
+  uint16_t  nSortCnt,nInd,nIndSort;
+  int16_t   nX,nY;
+  int16_t   nRunX0 = 0;
+  int16_t   nRunX1 = 0;
+  int16_t   nRunY  = 0;
+  bool      bRun   = false;
+
+  // Keep the display selected for all of the points
+  gslc_DrvWriteBegin();
+  for (uint16_t nIndPt=0;nIndPt<nNumPt;nIndPt+=nSortCnt) {
+    // The point array belongs to the caller, so a batch of the
+    // visible points is copied and sorted by row and then column
+    // (insertion sort) so that neighbors on a row become adjacent
+    nSortCnt = nNumPt - nIndPt;
+    nSortCnt = (nSortCnt > DRV_ADAGFX_POINTS_SORT)? DRV_ADAGFX_POINTS_SORT : nSortCnt;
+    nIndSort = 0;
+    for (nInd=0;nInd<nSortCnt;nInd++) {
+      sPt = asPt[nIndPt+nInd];
+#if (GSLC_CLIP_EN)
+      if (!gslc_ClipPt(&pDriver->rClipRect,sPt.x,sPt.y)) { continue; }
+#endif
+      uint16_t nIndIns = nIndSort++;
+      while ((nIndIns > 0) && ((asSort[nIndIns-1].y > sPt.y) ||
+        ((asSort[nIndIns-1].y == sPt.y) && (asSort[nIndIns-1].x > sPt.x)))) {
+        asSort[nIndIns] = asSort[nIndIns-1];
+        nIndIns--;
+      }
+      asSort[nIndIns] = sPt;
+    }
+
+    for (nInd=0;nInd<nIndSort;nInd++) {
+      nX = asSort[nInd].x;
+      nY = asSort[nInd].y;
+      // Merge points that extend the current run on the same row
+      // (in either direction) so that they share an address window
+      // - Runs can continue from the previous batch
+      if (bRun && (nY == nRunY)) {
+        if ((nX >= nRunX0) && (nX <= nRunX1)) { continue; }
+        if (nX == nRunX1+1) { nRunX1 = nX; continue; }
+        if (nX == nRunX0-1) { nRunX0 = nX; continue; }
+      }
+      if (bRun) {
+        gslc_DrvDrawPointRun_base(nRunX0,nRunX1,nRunY,nColRaw);
+      }
+      nRunX0 = nX;
+      nRunX1 = nX;
+      nRunY  = nY;
+      bRun   = true;
+    }
+  }
+  if (bRun) {
+    gslc_DrvDrawPointRun_base(nRunX0,nRunX1,nRunY,nColRaw);
+  }
+  gslc_DrvWriteEnd();
+  return true;
 }
 
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
@@ -1598,6 +1814,12 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   #elif defined(DRV_DISP_ADAGFX_RA8876) || defined(DRV_DISP_ADAGFX_RA8876_GV)
     // xlatb/RA8876 uses a non-standard fillRect() API
     m_disp.fillRect(rRect.x,rRect.y,rRect.x+rRect.w-1,rRect.y+rRect.h-1,nColRaw);
+  #elif defined(DRV_ADAGFX_WRITE_EN)
+    if (gslc_DrvWriteOpen()) {
+      m_disp.writeFillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+    } else {
+      m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+    }
   #else
     //NOTE:tested for ILI9225_DUE
     m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
@@ -1612,7 +1834,9 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
   // TODO: Support GSLC_CLIP_EN
   // - Would need to determine how to clip the rounded corners
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  bool bSuspended = gslc_DrvWriteSuspend();
   m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  gslc_DrvWriteResume(bSuspended);
 #else
   (void)rRect; // Unused
   (void)nRadius; // Unused
@@ -1664,7 +1888,9 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   #elif defined(DRV_DISP_ADAGFX_RA8876) || defined(DRV_DISP_ADAGFX_RA8876_GV)
     m_disp.drawRect(rRect.x,rRect.y,rRect.x+rRect.w-1,rRect.y+rRect.h-1,nColRaw);
   #else
+    bool bSuspended = gslc_DrvWriteSuspend();
     m_disp.drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+    gslc_DrvWriteResume(bSuspended);
   #endif
 #endif
   return true;
@@ -1678,7 +1904,9 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 
   // TODO: Support GSLC_CLIP_EN
   // - Would need to determine how to clip the rounded corners
+  bool bSuspended = gslc_DrvWriteSuspend();
   m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  gslc_DrvWriteResume(bSuspended);
 #else
   (void)rRect; // Unused
   (void)nRadius; // Unused
@@ -1703,6 +1931,73 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
   return true;
 }
 
+bool gslc_DrvDrawLines(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#else
+  (void)pGui; // Unused
+#endif
+
+  // Only perform the color conversion once for all segments
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  int16_t  nX0,nY0,nX1,nY1;
+
+  // Keep the display selected for all of the segments
+  gslc_DrvWriteBegin();
+  for (uint16_t nIndPt=1;nIndPt<nNumPt;nIndPt++) {
+    nX0 = asPt[nIndPt-1].x;
+    nY0 = asPt[nIndPt-1].y;
+    nX1 = asPt[nIndPt].x;
+    nY1 = asPt[nIndPt].y;
+#if (GSLC_CLIP_EN)
+    if (!gslc_ClipLine(&pDriver->rClipRect,&nX0,&nY0,&nX1,&nY1)) { continue; }
+#endif
+    #if defined(DRV_ADAGFX_WRITE_EN)
+    m_disp.writeLine(nX0,nY0,nX1,nY1,nColRaw);
+    #else
+    gslc_DrvDrawLine_base(nX0,nY0,nX1,nY1,nColRaw);
+    #endif
+  }
+  gslc_DrvWriteEnd();
+  return true;
+}
+
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol)
+{
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect    rClip   = pDriver->rClipRect;
+#else
+  (void)pGui; // Unused
+#endif
+
+  // Only perform the color conversion once for all spans
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  int16_t  nY,nX0,nX1;
+
+  // Keep the display selected for all of the spans
+  gslc_DrvWriteBegin();
+  for (uint16_t nIndSpan=0;nIndSpan<nNumSpan;nIndSpan++) {
+    nY  = asSpan[nIndSpan].y;
+    nX0 = asSpan[nIndSpan].x0;
+    nX1 = asSpan[nIndSpan].x1;
+#if (GSLC_CLIP_EN)
+    if ((nY < rClip.y) || (nY >= rClip.y + (int16_t)rClip.h)) { continue; }
+    if (nX0 < rClip.x) { nX0 = rClip.x; }
+    if (nX1 >= rClip.x + (int16_t)rClip.w) { nX1 = rClip.x + rClip.w - 1; }
+    if (nX0 > nX1) { continue; }
+#endif
+    #if defined(DRV_ADAGFX_WRITE_EN)
+    m_disp.writeFastHLine(nX0,nY,nX1-nX0+1,nColRaw);
+    #else
+    gslc_DrvDrawLine_base(nX0,nY,nX1,nY,nColRaw);
+    #endif
+  }
+  gslc_DrvWriteEnd();
+  return true;
+}
+
 bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
   (void)pGui;
@@ -1712,7 +2007,9 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  bool bSuspended = gslc_DrvWriteSuspend();
   m_disp.drawCircle(nMidX,nMidY,nRadius,nColRaw);
+  gslc_DrvWriteResume(bSuspended);
 #else
   (void)nMidX; // Unused
   (void)nMidY; // Unused
@@ -1731,7 +2028,9 @@ bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  bool bSuspended = gslc_DrvWriteSuspend();
   m_disp.fillCircle(nMidX,nMidY,nRadius,nColRaw);
+  gslc_DrvWriteResume(bSuspended);
 #else
   (void)nMidX; // Unused
   (void)nMidY; // Unused
@@ -1753,7 +2052,9 @@ bool gslc_DrvDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  bool bSuspended = gslc_DrvWriteSuspend();
   m_disp.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  gslc_DrvWriteResume(bSuspended);
 #else
   (void)nX0; // Unused
   (void)nY0; // Unused
@@ -1775,7 +2076,9 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  bool bSuspended = gslc_DrvWriteSuspend();
   m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  gslc_DrvWriteResume(bSuspended);
 #else
   (void)nX0; // Unused
   (void)nY0; // Unused
@@ -1790,6 +2093,132 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
 
 
+// -----------------------------------------------------------------------
+// Image streaming
+// - Images are output as runs of opaque pixels within a single bus
+//   transaction. On displays that support it, each run is streamed
+//   into an address window with one block write.
+// - A run that continues where the previous one ended in the address
+//   window is streamed without setting up a new window, so an image
+//   without transparent pixels only sets the window once.
+// -----------------------------------------------------------------------
+
+// Number of pixels buffered before a block write
+#if !defined(ADAGFX_BLIT_BUF)
+  #define ADAGFX_BLIT_BUF  32
+#endif
+
+typedef struct {
+  int16_t   nWinX0;     ///< Left edge of the current address window
+  int16_t   nWinX1;     ///< Right edge of the image region
+  int16_t   nWinY1;     ///< Bottom edge of the image region
+  int16_t   nCurX;      ///< Next pixel position in the address window
+  int16_t   nCurY;      ///< Next pixel position in the address window
+  bool      bWin;       ///< Address window has been set up
+  int16_t   nRunX;      ///< Start of buffered run
+  int16_t   nRunY;      ///< Row of buffered run
+  uint16_t  nRunLen;    ///< Number of pixels in buffered run
+  uint16_t  anRun[ADAGFX_BLIT_BUF]; ///< Buffered run of raw pixels
+} gslc_tsDrvBlit;
+
+inline void gslc_DrvWriteHLine_base(int16_t nX,int16_t nY,int16_t nW,uint16_t nColRaw)
+{
+  #if defined(DRV_ADAGFX_WRITE_EN)
+  m_disp.writeFastHLine(nX,nY,nW,nColRaw);
+  #else
+  gslc_DrvDrawLine_base(nX,nY,nX+nW-1,nY,nColRaw);
+  #endif
+}
+
+void gslc_DrvBlitBegin(gslc_tsDrvBlit* pBlit,gslc_tsRect rRect)
+{
+  pBlit->nWinX0  = 0;
+  pBlit->nWinX1  = rRect.x + rRect.w - 1;
+  pBlit->nWinY1  = rRect.y + rRect.h - 1;
+  pBlit->nCurX   = 0;
+  pBlit->nCurY   = 0;
+  pBlit->bWin    = false;
+  pBlit->nRunX   = 0;
+  pBlit->nRunY   = 0;
+  pBlit->nRunLen = 0;
+  gslc_DrvWriteBegin();
+}
+
+void gslc_DrvBlitFlush(gslc_tsDrvBlit* pBlit)
+{
+  uint16_t nLen = pBlit->nRunLen;
+  if (nLen == 0) { return; }
+  int16_t  nX = pBlit->nRunX;
+  int16_t  nY = pBlit->nRunY;
+  #if defined(DRV_ADAGFX_BLIT_EN)
+  if ((!pBlit->bWin) || (nX != pBlit->nCurX) || (nY != pBlit->nCurY)) {
+    // Open a window from the run to the bottom-right of the image
+    m_disp.setAddrWindow(nX,nY,pBlit->nWinX1-nX+1,pBlit->nWinY1-nY+1);
+    pBlit->nWinX0 = nX;
+    pBlit->bWin   = true;
+  }
+  m_disp.writePixels(pBlit->anRun,nLen);
+  pBlit->nCurX = nX + nLen;
+  pBlit->nCurY = nY;
+  if (pBlit->nCurX > pBlit->nWinX1) {
+    // The window wraps to the start of the next row
+    pBlit->nCurX = pBlit->nWinX0;
+    pBlit->nCurY++;
+  }
+  #else
+  for (uint16_t nInd=0;nInd<nLen;nInd++) {
+    #if defined(DRV_ADAGFX_WRITE_EN)
+    m_disp.writePixel(nX+nInd,nY,pBlit->anRun[nInd]);
+    #else
+    gslc_DrvDrawPoint_base(nX+nInd,nY,pBlit->anRun[nInd]);
+    #endif
+  }
+  #endif
+  pBlit->nRunLen = 0;
+}
+
+inline void gslc_DrvBlitPush(gslc_tsDrvBlit* pBlit,int16_t nX,int16_t nY,uint16_t nColRaw)
+{
+  if (pBlit->nRunLen == ADAGFX_BLIT_BUF) {
+    gslc_DrvBlitFlush(pBlit);
+  }
+  if (pBlit->nRunLen == 0) {
+    pBlit->nRunX = nX;
+    pBlit->nRunY = nY;
+  }
+  pBlit->anRun[pBlit->nRunLen++] = nColRaw;
+}
+
+// Output a solid run of pixels
+void gslc_DrvBlitFill(gslc_tsDrvBlit* pBlit,int16_t nX,int16_t nY,int16_t nW,uint16_t nColRaw)
+{
+  gslc_DrvBlitFlush(pBlit);
+  // The fill sets up its own address window
+  pBlit->bWin = false;
+  gslc_DrvWriteHLine_base(nX,nY,nW,nColRaw);
+}
+
+// Release the display bus part way through a blit
+// - The address window is set up again after the bus is reacquired
+void gslc_DrvBlitSuspend(gslc_tsDrvBlit* pBlit)
+{
+  gslc_DrvBlitFlush(pBlit);
+  pBlit->bWin = false;
+  gslc_DrvWriteEnd();
+}
+
+void gslc_DrvBlitResume(gslc_tsDrvBlit* pBlit)
+{
+  (void)pBlit; // Unused
+  gslc_DrvWriteBegin();
+}
+
+void gslc_DrvBlitEnd(gslc_tsDrvBlit* pBlit)
+{
+  gslc_DrvBlitFlush(pBlit);
+  gslc_DrvWriteEnd();
+}
+
 // ----- REFERENCE CODE begin
 // The following code was based upon the following reference code but modified to
 // adapt for use in GUIslice.
@@ -1826,30 +2255,62 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
   nCol.g  =   (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++);
   nCol.b  =   (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++);
 
+  // Determine the visible portion of the image
+  gslc_tsRect rImg = (gslc_tsRect){nDstX,nDstY,(uint16_t)w,(uint16_t)h};
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+#else
+  (void)pGui; // Unused
+#endif
+  int16_t nImgX0 = rImg.x - nDstX;
+  int16_t nImgX1 = nImgX0 + rImg.w - 1;
+  int16_t nImgY0 = rImg.y - nDstY;
+  int16_t nImgY1 = nImgY0 + rImg.h - 1;
+
+  // Only perform the color conversion once for the entire image
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+
   int16_t i, j, byteWidth = (w + 7) / 8;
+  int16_t nRunX;
   uint8_t nByte = 0;
 
-  for(j=0; j<h; j++) {
-    for(i=0; i<w; i++) {
-      if(i & 7) nByte <<= 1;
+  // Output each row as horizontal runs of set bits
+  gslc_DrvWriteBegin();
+  for(j=nImgY0; j<=nImgY1; j++) {
+    nRunX = -1;
+    for(i=nImgX0; i<=nImgX1; i++) {
+      if((i & 7) && (i != nImgX0)) nByte <<= 1;
       else {
         if (bProgMem) {
           nByte = pgm_read_byte(bmap_base + j * byteWidth + i / 8);
         } else {
           nByte = bmap_base[j * byteWidth + i / 8];
         }
+        nByte <<= (i & 7);
       }
       if(nByte & 0x80) {
-        gslc_DrvDrawPoint(pGui,nDstX+i,nDstY+j,nCol);
+        if (nRunX < 0) { nRunX = i; }
+      } else if (nRunX >= 0) {
+        gslc_DrvWriteHLine_base(nDstX+nRunX,nDstY+j,i-nRunX,nColRaw);
+        nRunX = -1;
       }
     }
+    if (nRunX >= 0) {
+      gslc_DrvWriteHLine_base(nDstX+nRunX,nDstY+j,nImgX1-nRunX+1,nColRaw);
+    }
   }
+  gslc_DrvWriteEnd();
 }
 // ----- REFERENCE CODE end
 
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
 {
-  // AdaFruit GFX doesn't have a routine for this so we output pixel by pixel
+  // The visible rows are streamed as runs of opaque pixels. With
+  // DRV_ADAGFX_BLIT_EN each run is written through setAddrWindow() and
+  // writePixels(), otherwise it is output pixel by pixel. Without the
+  // streaming, images in RAM are handed to drawRGBBitmap() if enabled
+  // by DRV_HAS_DRAW_BMP_MEM.
   const uint16_t* pImage = (const uint16_t*)pBitmap;
   int16_t h, w;
   if (bProgMem) {
@@ -1862,41 +2323,133 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
   #if defined(DBG_DRIVER)
   GSLC_DEBUG_PRINT("DBG: DrvDrawBmp24FromMem() w=%d h=%d\n", w, h);
   #endif
-  #if (DRV_HAS_DRAW_BMP_MEM)
+  #if (DRV_HAS_DRAW_BMP_MEM) && !defined(DRV_ADAGFX_BLIT_EN)
   if (!bProgMem) {
+    bool bSuspended = gslc_DrvWriteSuspend();
     m_disp.drawRGBBitmap(nDstX, nDstY, (uint16_t*) pImage,w, h); 
+    gslc_DrvWriteResume(bSuspended);
     return;
   }
   #endif
-  int row, col;
+
+  // Determine the visible portion of the image
+  gslc_tsRect rImg = (gslc_tsRect){nDstX,nDstY,(uint16_t)w,(uint16_t)h};
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+#endif
+
+  // Only perform the transparent color conversion once
+  uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+
+  // Stream each row as runs of opaque pixels
+  gslc_tsDrvBlit sBlit;
+  gslc_DrvBlitBegin(&sBlit,rImg);
+  int16_t row, col;
   uint16_t nColRaw;
-  for (row=0; row<h; row++) { // For each scanline...
-    for (col=0; col<w; col++) { // For each pixel...
+  const uint16_t* pRow;
+  for (row=rImg.y; row<rImg.y+(int16_t)rImg.h; row++) { // For each scanline...
+    pRow = pImage + (int32_t)(row-nDstY)*w + (rImg.x-nDstX);
+    for (col=rImg.x; col<rImg.x+(int16_t)rImg.w; col++) { // For each pixel...
 
       // Fetch the requested pixel value
       if (bProgMem) {
         // To read from Flash Memory, pgm_read_XXX is required.
         // Since image is stored as uint16_t, pgm_read_word is used as it uses 16bit address
-        nColRaw = pgm_read_word(pImage++);
+        nColRaw = pgm_read_word(pRow++);
       } else {
-        nColRaw = *(pImage++);
+        nColRaw = *(pRow++);
       }
 
       // If transparency is enabled, check to see if pixel should be masked
-      bool bDrawBit = true;
-      if (GSLC_BMP_TRANS_EN) {
-        uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
-        if (nColRaw == nTransRaw) {
-          bDrawBit = false;
-        }
-      }
-
-      // Draw the pixel if not masked
-      if (bDrawBit) {
-        gslc_DrvDrawPoint_base(nDstX+col, nDstY+row, nColRaw);
+      if ((GSLC_BMP_TRANS_EN) && (nColRaw == nTransRaw)) {
+        gslc_DrvBlitFlush(&sBlit);
+      } else {
+        gslc_DrvBlitPush(&sBlit,col,row,nColRaw);
       }
     } // end pixel
+    gslc_DrvBlitFlush(&sBlit);
   }
+  gslc_DrvBlitEnd(&sBlit);
+}
+
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  int16_t h, w;
+  if (bProgMem) {
+    h = pgm_read_word(pImage++);
+    w = pgm_read_word(pImage++);
+  } else {
+    h = *(pImage++);
+    w = *(pImage++);
+  }
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: DrvDrawRle16FromMem() w=%d h=%d\n", w, h);
+  #endif
+
+  // Determine the visible portion of the image
+  gslc_tsRect rImg = (gslc_tsRect){nDstX,nDstY,(uint16_t)w,(uint16_t)h};
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+#else
+  (void)pGui; // Unused
+#endif
+  int16_t nVisX1 = rImg.x + rImg.w - 1;
+  int16_t nVisY1 = rImg.y + rImg.h - 1;
+
+  gslc_tsDrvBlit sBlit;
+  gslc_DrvBlitBegin(&sBlit,rImg);
+  int16_t  nImgX = 0;
+  int16_t  nY    = nDstY;
+  int16_t  nX0,nX1,nX;
+  uint16_t nRun,nCnt,nColRaw;
+  while (nY <= nVisY1) {
+    nRun = (bProgMem)? pgm_read_word(pImage++) : *(pImage++);
+    nCnt = nRun & GSLC_RLE16_CNT_MASK;
+    if ((nCnt == 0) || (nImgX + nCnt > w)) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawRle16FromMem() invalid run at row %d\n",nY-nDstY);
+      break;
+    }
+    // Determine the visible portion of the run
+    nX0 = nDstX + nImgX;
+    nX1 = nX0 + nCnt - 1;
+    if (nY < rImg.y) { nX1 = nX0 - 1; }
+    if (nX0 < rImg.x) { nX0 = rImg.x; }
+    if (nX1 > nVisX1) { nX1 = nVisX1; }
+
+    switch (nRun & GSLC_RLE16_OP_MASK) {
+      case GSLC_RLE16_OP_COPY:
+        for (nX = nX0; nX <= nX1; nX++) {
+          const uint16_t* pPix = pImage + (nX - (nDstX + nImgX));
+          nColRaw = (bProgMem)? pgm_read_word(pPix) : *pPix;
+          gslc_DrvBlitPush(&sBlit,nX,nY,nColRaw);
+        }
+        pImage += nCnt;
+        break;
+      case GSLC_RLE16_OP_FILL:
+        // Solid runs become a single fill
+        nColRaw = (bProgMem)? pgm_read_word(pImage++) : *(pImage++);
+        if (nX0 <= nX1) {
+          gslc_DrvBlitFill(&sBlit,nX0,nY,nX1-nX0+1,nColRaw);
+        }
+        break;
+      default:
+        // Transparent runs are skipped entirely
+        gslc_DrvBlitFlush(&sBlit);
+        break;
+    }
+
+    // Runs do not cross rows
+    nImgX += nCnt;
+    if (nImgX == w) {
+      gslc_DrvBlitFlush(&sBlit);
+      nImgX = 0;
+      nY++;
+    }
+  }
+  gslc_DrvBlitEnd(&sBlit);
 }
 
 #if (GSLC_SD_EN)
@@ -1908,149 +2461,111 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
 //   Original author:  Adafruit
 //   Function:         bmpDraw()
 
-// These read 16- and 32-bit types from the SD card file.
-// BMP data is stored little-endian, Arduino is little-endian too.
-// May need to reverse subscript order if porting elsewhere.
-uint16_t gslc_DrvRead16SD(File &f) {
-  uint16_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read(); // MSB
-  return result;
+// SD card file access for gslc_BmpStreamOpen()
+// - The SD card may share the SPI bus with the display, so any
+//   pixels buffered for the display are written out and the
+//   display transaction is released during each access
+typedef struct {
+  File*           pFile;  ///< Open image file
+  gslc_tsDrvBlit* pBlit;  ///< Blit in progress (or NULL)
+} gslc_tsDrvFileSD;
+
+int32_t gslc_DrvFileReadSD(void* pvFile,uint8_t* pBuf,uint16_t nLen)
+{
+  gslc_tsDrvFileSD* pFileSD = (gslc_tsDrvFileSD*)pvFile;
+  if (pFileSD->pBlit) { gslc_DrvBlitSuspend(pFileSD->pBlit); }
+  int32_t nRead = pFileSD->pFile->read(pBuf,nLen);
+  if (pFileSD->pBlit) { gslc_DrvBlitResume(pFileSD->pBlit); }
+  return nRead;
 }
 
-uint32_t gslc_DrvRead32SD(File &f) {
-  uint32_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read();
-  ((uint8_t *)&result)[2] = f.read();
-  ((uint8_t *)&result)[3] = f.read(); // MSB
-  return result;
+bool gslc_DrvFileSeekSD(void* pvFile,uint32_t nPos)
+{
+  gslc_tsDrvFileSD* pFileSD = (gslc_tsDrvFileSD*)pvFile;
+  if (pFileSD->pBlit) { gslc_DrvBlitSuspend(pFileSD->pBlit); }
+  bool bOk = pFileSD->pFile->seek(nPos);
+  if (pFileSD->pBlit) { gslc_DrvBlitResume(pFileSD->pBlit); }
+  return bOk;
 }
 
 void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
 {
   File     bmpFile;
-  int      bmpWidth, bmpHeight;   // W+H in pixels
-  uint8_t  bmpDepth;              // Bit depth (currently must be 24)
-  uint32_t bmpImageoffset;        // Start of image data in file
-  uint32_t rowSize;               // Not always = bmpWidth; may have padding
-  uint8_t  sdbuffer[3*GSLC_SD_BUFFPIXEL]; // pixel buffer (R+G+B per pixel)
-  uint8_t  buffidx = sizeof(sdbuffer); // Current position in sdbuffer
-  boolean  goodBmp = false;       // Set to true on valid header parse
-  boolean  flip    = true;        // BMP is stored bottom-to-top
-  int      w, h, row, col;
-  uint8_t  r, g, b;
-  uint32_t pos = 0, startTime = millis();
-  (void)startTime; // Unused
+  uint8_t  sdbuffer[3*GSLC_SD_BUFFPIXEL]; // BMP file buffer (one or more rows)
+  gslc_tsBmpStream  sStream;
+  gslc_tsDrvFileSD  sFileSD;
+  gslc_tsDrvBlit    sBlit;
 
   if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
 
-  //Serial.println();
-  //Serial.print("Loading image '");
-  //Serial.print(filename);
-  //Serial.println('\'');
+  // The SD card may share the bus with the display, so release it
+  bool bSuspended = gslc_DrvWriteSuspend();
 
   // Open requested file on SD card
   if ((bmpFile = SD.open(filename)) == 0) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file not found [%s]",filename);
+    gslc_DrvWriteResume(bSuspended);
     return;
   }
+  sFileSD.pFile = &bmpFile;
+  sFileSD.pBlit = NULL;
+
   // Parse BMP header
-  if(gslc_DrvRead16SD(bmpFile) == 0x4D42) { // BMP signature
-    uint32_t nFileSize = gslc_DrvRead32SD(bmpFile);
-    (void)nFileSize; // Unused
-    //Serial.print("File size: "); Serial.println(nFileSize);
-    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
-    bmpImageoffset = gslc_DrvRead32SD(bmpFile); // Start of image data
-    //Serial.print("Image Offset: "); Serial.println(bmpImageoffset, DEC);
-    // Read DIB header
-    uint32_t nHdrSize = gslc_DrvRead32SD(bmpFile);
-    (void)nHdrSize; // Unused
-    //Serial.print("Header size: "); Serial.println(nHdrSize);
-    bmpWidth  = gslc_DrvRead32SD(bmpFile);
-    bmpHeight = gslc_DrvRead32SD(bmpFile);
-    if(gslc_DrvRead16SD(bmpFile) == 1) { // # planes -- must be '1'
-      bmpDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
-      //Serial.print("Bit Depth: "); Serial.println(bmpDepth);
-      if((bmpDepth == 24) && (gslc_DrvRead32SD(bmpFile) == 0)) { // 0 = uncompressed
-        goodBmp = true; // Supported BMP format -- proceed!
-        //Serial.print("Image size: ");
-        //Serial.print(bmpWidth);
-        //Serial.print('x');
-        //Serial.println(bmpHeight);
-
-        // BMP rows are padded (if needed) to 4-byte boundary
-        rowSize = (bmpWidth * 3 + 3) & ~3;
-
-        // If bmpHeight is negative, image is in top-down order.
-        // This is not canon but has been observed in the wild.
-        if(bmpHeight < 0) {
-          bmpHeight = -bmpHeight;
-          flip      = false;
-        }
+  if (!gslc_BmpStreamOpen(&sStream,&sFileSD,&gslc_DrvFileReadSD,&gslc_DrvFileSeekSD,sdbuffer,sizeof(sdbuffer))) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
+    bmpFile.close();
+    gslc_DrvWriteResume(bSuspended);
+    return;
+  }
 
-        // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
-
-        // Set TFT address window to clipped image bounds
-        //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
-
-        for (row=0; row<h; row++) { // For each scanline...
-
-          // Seek to start of scan line.  It might seem labor-
-          // intensive to be doing this on every line, but this
-          // method covers a lot of gritty details like cropping
-          // and scanline padding.  Also, the seek only takes
-          // place if the file position actually needs to change
-          // (avoids a lot of cluster math in SD library).
-          if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
-            pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
-          else     // Bitmap is stored top-to-bottom
-            pos = bmpImageoffset + row * rowSize;
-          if(bmpFile.position() != pos) { // Need seek?
-            bmpFile.seek(pos);
-            buffidx = sizeof(sdbuffer); // Force buffer reload
-          }
-
-          for (col=0; col<w; col++) { // For each pixel...
-            // Time to read more pixel data?
-            if (buffidx >= sizeof(sdbuffer)) { // Indeed
-              bmpFile.read(sdbuffer, sizeof(sdbuffer));
-              buffidx = 0; // Set index to beginning
-            }
-
-            // Convert pixel from BMP to TFT format, push to display
-            b = sdbuffer[buffidx++];
-            g = sdbuffer[buffidx++];
-            r = sdbuffer[buffidx++];
-            //xxx tft.pushColor(tft.Color565(r,g,b));
-            gslc_tsColor nCol = (gslc_tsColor){r,g,b};
-            bool bDrawBit = true;
-            if (GSLC_BMP_TRANS_EN) {
-              gslc_tsColor nColTrans = pGui->sTransCol;
-              if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
-                bDrawBit = false;
-              }
-            }
-            if (bDrawBit) {
-              gslc_DrvDrawPoint(pGui,x+col,y+row,nCol);
-            }
-
-          } // end pixel
-        } // end scanline
-        //Serial.print("Loaded in ");
-        //Serial.print(millis() - startTime);
-        //Serial.println(" ms");
-      } // end goodBmp
+  // Determine the visible portion of the image
+  // - Only the rows within it are read from the file
+  gslc_tsRect rImg = (gslc_tsRect){(int16_t)x,(int16_t)y,(uint16_t)sStream.nImgW,(uint16_t)sStream.nImgH};
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rClip = pDriver->rClipRect;
+#else
+  gslc_tsRect rClip = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+#endif
+  if ((!gslc_ClipRect(&rClip,&rImg)) ||
+      (!gslc_BmpStreamSetRegion(&sStream,(gslc_tsRect){(int16_t)(rImg.x-x),(int16_t)(rImg.y-y),rImg.w,rImg.h}))) {
+    bmpFile.close();
+    gslc_DrvWriteResume(bSuspended);
+    return;
+  }
+
+  gslc_tsColor nColTrans = pGui->sTransCol;
+
+  // Convert each row to the native format and stream the
+  // runs of opaque pixels to the display
+  gslc_DrvBlitBegin(&sBlit,rImg);
+  sFileSD.pBlit = &sBlit;
+  int16_t         nImgX, nImgY;
+  uint16_t        nCnt, nInd;
+  uint8_t         nPixBytes = sStream.nPixBytes;
+  const uint8_t*  pPix;
+  while ((nCnt = gslc_BmpStreamRead(&sStream,&nImgX,&nImgY,&pPix)) > 0) {
+    int16_t nDstX = x + nImgX;
+    int16_t nDstY = y + nImgY;
+    for (nInd=0; nInd<nCnt; nInd++) {
+      // BMP pixels are stored as B,G,R(,A)
+      gslc_tsColor nCol = (gslc_tsColor){pPix[2],pPix[1],pPix[0]};
+      pPix += nPixBytes;
+      // If transparency is enabled, check to see if pixel should be masked
+      if ((GSLC_BMP_TRANS_EN) && (nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
+        gslc_DrvBlitFlush(&sBlit);
+      } else {
+        gslc_DrvBlitPush(&sBlit,nDstX+nInd,nDstY,gslc_DrvAdaptColorToRaw(nCol));
+      }
     }
+    // Runs must not cross rows
+    gslc_DrvBlitFlush(&sBlit);
   }
+  sFileSD.pBlit = NULL;
+  gslc_DrvBlitEnd(&sBlit);
+
   bmpFile.close();
-  if(!goodBmp) {
-    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
-  }
+  gslc_DrvWriteResume(bSuspended);
 }
 // ----- REFERENCE CODE end
 #endif // GSLC_SD_EN
@@ -2084,6 +2599,10 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // 24-bit Bitmap in ram
       gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
       return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Run-length encoded RGB565 image in ram
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
     } else {
       return false; // TODO: not yet supported
     }
@@ -2100,6 +2619,10 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // 24-bit Bitmap in flash
       gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
       return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Run-length encoded RGB565 image in flash
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
+      return true;
     } else {
       return false; // TODO: not yet supported
     }
@@ -131,8 +131,10 @@ extern "C" {
 
 #define DRV_HAS_DRAW_POINT             1 ///< Support gslc_DrvDrawPoint()
 
-#define DRV_HAS_DRAW_POINTS            0 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
 #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_LINES             1 ///< Support gslc_DrvDrawLines()
+#define DRV_HAS_DRAW_SPANS             1 ///< Support gslc_DrvDrawSpans()
 #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
 #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
 #define DRV_HAS_DRAW_RECT_ROUND_FRAME  1 ///< Support gslc_DrvDrawFrameRoundRect()
@@ -145,6 +147,25 @@ extern "C" {
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
 
 #define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
+// Hold one display bus transaction across each page redraw
+// (may be disabled in the config to compare bus activity)
+#if !defined(DRV_HAS_REDRAW_BATCH)
+  #define DRV_HAS_REDRAW_BATCH         1 ///< Support gslc_DrvRedrawBegin() / gslc_DrvRedrawEnd()
+#endif
+#define DRV_HAS_READ_RECT              0 ///< Support gslc_DrvReadRect() / gslc_DrvWriteRect()
+#define DRV_HAS_SPRITE                 0 ///< Support gslc_DrvSpriteCreate() and off-screen drawing
+
+// Number of points that gslc_DrvDrawPoints() sorts at a time so that
+// points on the same row can be merged into runs. The points are
+// copied onto the stack (4 bytes each), so reduce this on devices
+// with little RAM.
+#if !defined(DRV_ADAGFX_POINTS_SORT)
+  #if defined(__AVR__)
+    #define DRV_ADAGFX_POINTS_SORT      16
+  #else
+    #define DRV_ADAGFX_POINTS_SORT      64
+  #endif
+#endif
 
 
 // -----------------------------------------------------------------------
@@ -460,6 +481,28 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 // Screen Management Functions
 // -----------------------------------------------------------------------
 
+///
+/// Start a page redraw
+/// - Called before the elements are drawn by gslc_PageRedrawGo() so
+///   that the display bus transaction can be held open for the
+///   entire redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvRedrawBegin(gslc_tsGui* pGui);
+
+///
+/// Finish a page redraw
+/// - Releases the display bus transaction opened by gslc_DrvRedrawBegin()
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvRedrawEnd(gslc_tsGui* pGui);
+
 ///
 /// Force a page flip to occur. This generally copies active
 /// screen surface to the display.
@@ -488,7 +531,10 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
 
 ///
-/// Draw a point
+/// Draw a set of points
+/// - All points are written within a single bus transaction
+/// - Consecutive points that are adjacent on the same row are
+///   merged into a horizontal run
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  asPt:        Array of points to draw
@@ -564,6 +610,30 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
 ///
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
+///
+/// Draw a series of connected lines
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to connect
+/// \param[in]  nNumPt:      Number of points in array (at least 2)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLines(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Fill a series of horizontal spans
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans (x0 <= x1, inclusive)
+/// \param[in]  nNumSpan:    Number of spans in array
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol);
+
 
 ///
 /// Draw a framed circle
@@ -676,6 +746,21 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, cons
 ///
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
 
+///
+/// Draw a run-length encoded RGB565 bitmap from a memory array
+/// - See GSLC_IMGREF_FMT_RLE16 for the array format
+/// - Solid runs are drawn as fills and transparent runs are skipped
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
 ///
 /// Draw a color 24-bit depth bitmap from SD card
 ///
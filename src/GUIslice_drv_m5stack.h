@@ -71,6 +71,8 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 
 #define DRV_HAS_DRAW_POINTS            0 ///< Support gslc_DrvDrawPoints()
 #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_LINES             0 ///< Support gslc_DrvDrawLines()
+#define DRV_HAS_DRAW_SPANS             0 ///< Support gslc_DrvDrawSpans()
 #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
 #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
 #define DRV_HAS_DRAW_RECT_ROUND_FRAME  1 ///< Support gslc_DrvDrawFrameRoundRect()
@@ -83,6 +85,9 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
 
 #define DRV_OVERRIDE_TXT_ALIGN         1 ///< Driver provides text alignment
+#define DRV_HAS_REDRAW_BATCH           0 ///< Support gslc_DrvRedrawBegin() / gslc_DrvRedrawEnd()
+#define DRV_HAS_READ_RECT              0 ///< Support gslc_DrvReadRect() / gslc_DrvWriteRect()
+#define DRV_HAS_SPRITE                 0 ///< Support gslc_DrvSpriteCreate() and off-screen drawing
 
 // =======================================================================
 // Driver-specific members
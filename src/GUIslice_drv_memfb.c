@@ -0,0 +1,1501 @@
+// =======================================================================
+// GUIslice library (driver layer for headless memory framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_memfb.c
+
+// Compiler guard for requested driver
+#include "GUIslice_config.h" // Sets DRV_DISP_*
+#if defined(DRV_DISP_MEMFB)
+
+// =======================================================================
+// Driver Layer for headless memory framebuffer
+// =======================================================================
+
+
+// GUIslice library
+#include "GUIslice_drv_memfb.h"
+
+#include <stdio.h>
+#include <stdlib.h>   // For malloc(), free()
+#include <string.h>   // For memset()
+
+// Define driver names
+const char* m_acDrvDisp = "MEMFB";
+
+#if defined(DRV_TOUCH_MEMFB)
+  const char* m_acDrvTouch = "MEMFB";
+#else
+  const char* m_acDrvTouch = "NONE";
+#endif
+
+
+// ------------------------------------------------------------------------
+// Built-in font
+// - Classic 5x7 font covering ASCII 0x20..0x7E
+// - Each glyph is 5 columns, LSB at top. Rendered in a 6x8 cell.
+// ------------------------------------------------------------------------
+#define DRV_MEMFB_FONT_CHAR_FIRST   0x20
+#define DRV_MEMFB_FONT_CHAR_LAST    0x7E
+#define DRV_MEMFB_FONT_GLYPH_W      5
+#define DRV_MEMFB_FONT_CELL_W       6
+#define DRV_MEMFB_FONT_CELL_H       8
+
+static const uint8_t m_anFontGlyph[] = {
+  0x00,0x00,0x00,0x00,0x00, // ' '
+  0x00,0x00,0x5F,0x00,0x00, // '!'
+  0x00,0x07,0x00,0x07,0x00, // '"'
+  0x14,0x7F,0x14,0x7F,0x14, // '#'
+  0x24,0x2A,0x7F,0x2A,0x12, // '$'
+  0x23,0x13,0x08,0x64,0x62, // '%'
+  0x36,0x49,0x56,0x20,0x50, // '&'
+  0x00,0x08,0x07,0x03,0x00, // '''
+  0x00,0x1C,0x22,0x41,0x00, // '('
+  0x00,0x41,0x22,0x1C,0x00, // ')'
+  0x2A,0x1C,0x7F,0x1C,0x2A, // '*'
+  0x08,0x08,0x3E,0x08,0x08, // '+'
+  0x00,0x80,0x70,0x30,0x00, // ','
+  0x08,0x08,0x08,0x08,0x08, // '-'
+  0x00,0x00,0x60,0x60,0x00, // '.'
+  0x20,0x10,0x08,0x04,0x02, // '/'
+  0x3E,0x51,0x49,0x45,0x3E, // '0'
+  0x00,0x42,0x7F,0x40,0x00, // '1'
+  0x72,0x49,0x49,0x49,0x46, // '2'
+  0x21,0x41,0x49,0x4D,0x33, // '3'
+  0x18,0x14,0x12,0x7F,0x10, // '4'
+  0x27,0x45,0x45,0x45,0x39, // '5'
+  0x3C,0x4A,0x49,0x49,0x31, // '6'
+  0x41,0x21,0x11,0x09,0x07, // '7'
+  0x36,0x49,0x49,0x49,0x36, // '8'
+  0x46,0x49,0x49,0x29,0x1E, // '9'
+  0x00,0x00,0x14,0x00,0x00, // ':'
+  0x00,0x40,0x34,0x00,0x00, // ';'
+  0x00,0x08,0x14,0x22,0x41, // '<'
+  0x14,0x14,0x14,0x14,0x14, // '='
+  0x00,0x41,0x22,0x14,0x08, // '>'
+  0x02,0x01,0x59,0x09,0x06, // '?'
+  0x3E,0x41,0x5D,0x59,0x4E, // '@'
+  0x7C,0x12,0x11,0x12,0x7C, // 'A'
+  0x7F,0x49,0x49,0x49,0x36, // 'B'
+  0x3E,0x41,0x41,0x41,0x22, // 'C'
+  0x7F,0x41,0x41,0x41,0x3E, // 'D'
+  0x7F,0x49,0x49,0x49,0x41, // 'E'
+  0x7F,0x09,0x09,0x09,0x01, // 'F'
+  0x3E,0x41,0x41,0x51,0x73, // 'G'
+  0x7F,0x08,0x08,0x08,0x7F, // 'H'
+  0x00,0x41,0x7F,0x41,0x00, // 'I'
+  0x20,0x40,0x41,0x3F,0x01, // 'J'
+  0x7F,0x08,0x14,0x22,0x41, // 'K'
+  0x7F,0x40,0x40,0x40,0x40, // 'L'
+  0x7F,0x02,0x1C,0x02,0x7F, // 'M'
+  0x7F,0x04,0x08,0x10,0x7F, // 'N'
+  0x3E,0x41,0x41,0x41,0x3E, // 'O'
+  0x7F,0x09,0x09,0x09,0x06, // 'P'
+  0x3E,0x41,0x51,0x21,0x5E, // 'Q'
+  0x7F,0x09,0x19,0x29,0x46, // 'R'
+  0x26,0x49,0x49,0x49,0x32, // 'S'
+  0x03,0x01,0x7F,0x01,0x03, // 'T'
+  0x3F,0x40,0x40,0x40,0x3F, // 'U'
+  0x1F,0x20,0x40,0x20,0x1F, // 'V'
+  0x3F,0x40,0x38,0x40,0x3F, // 'W'
+  0x63,0x14,0x08,0x14,0x63, // 'X'
+  0x03,0x04,0x78,0x04,0x03, // 'Y'
+  0x61,0x59,0x49,0x4D,0x43, // 'Z'
+  0x00,0x7F,0x41,0x41,0x41, // '['
+  0x02,0x04,0x08,0x10,0x20, // '\'
+  0x00,0x41,0x41,0x41,0x7F, // ']'
+  0x04,0x02,0x01,0x02,0x04, // '^'
+  0x40,0x40,0x40,0x40,0x40, // '_'
+  0x00,0x03,0x07,0x08,0x00, // '`'
+  0x20,0x54,0x54,0x78,0x40, // 'a'
+  0x7F,0x28,0x44,0x44,0x38, // 'b'
+  0x38,0x44,0x44,0x44,0x28, // 'c'
+  0x38,0x44,0x44,0x28,0x7F, // 'd'
+  0x38,0x54,0x54,0x54,0x18, // 'e'
+  0x00,0x08,0x7E,0x09,0x02, // 'f'
+  0x18,0xA4,0xA4,0x9C,0x78, // 'g'
+  0x7F,0x08,0x04,0x04,0x78, // 'h'
+  0x00,0x44,0x7D,0x40,0x00, // 'i'
+  0x20,0x40,0x40,0x3D,0x00, // 'j'
+  0x7F,0x10,0x28,0x44,0x00, // 'k'
+  0x00,0x41,0x7F,0x40,0x00, // 'l'
+  0x7C,0x04,0x78,0x04,0x78, // 'm'
+  0x7C,0x08,0x04,0x04,0x78, // 'n'
+  0x38,0x44,0x44,0x44,0x38, // 'o'
+  0xFC,0x18,0x24,0x24,0x18, // 'p'
+  0x18,0x24,0x24,0x18,0xFC, // 'q'
+  0x7C,0x08,0x04,0x04,0x08, // 'r'
+  0x48,0x54,0x54,0x54,0x24, // 's'
+  0x04,0x04,0x3F,0x44,0x24, // 't'
+  0x3C,0x40,0x40,0x20,0x7C, // 'u'
+  0x1C,0x20,0x40,0x20,0x1C, // 'v'
+  0x3C,0x40,0x30,0x40,0x3C, // 'w'
+  0x44,0x28,0x10,0x28,0x44, // 'x'
+  0x4C,0x90,0x90,0x90,0x7C, // 'y'
+  0x44,0x64,0x54,0x4C,0x44, // 'z'
+  0x00,0x08,0x36,0x41,0x00, // '{'
+  0x00,0x00,0x77,0x00,0x00, // '|'
+  0x00,0x41,0x36,0x08,0x00, // '}'
+  0x02,0x01,0x02,0x04,0x02, // '~'
+};
+
+// Determine the integer scale factor to apply to the built-in font
+static uint8_t gslc_DrvFontScale(gslc_tsFont* pFont)
+{
+  uint16_t nScale;
+  if (pFont->eFontRefType == GSLC_FONTREF_FNAME) {
+    // Font size is specified as a point size
+    nScale = pFont->nSize / DRV_MEMFB_FONT_CELL_H;
+  } else {
+    // Font size is specified as a scale factor
+    nScale = pFont->nSize;
+  }
+  if (nScale < 1)  { nScale = 1; }
+  if (nScale > 16) { nScale = 16; }
+  return (uint8_t)nScale;
+}
+
+// Fetch the glyph index for the next character in a string and
+// advance the string pointer. UTF-8 sequences are consumed as a
+// single character and rendered as '?'.
+static uint8_t gslc_DrvFontNextChar(const char** ppStr,gslc_teTxtFlags eTxtFlags)
+{
+  uint8_t nCh = (uint8_t)(**ppStr);
+  (*ppStr)++;
+  if ((nCh >= 0x80) && ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8)) {
+    // Skip over any continuation bytes
+    while (((uint8_t)(**ppStr) & 0xC0) == 0x80) {
+      (*ppStr)++;
+    }
+    nCh = '?';
+  }
+  if ((nCh < DRV_MEMFB_FONT_CHAR_FIRST) || (nCh > DRV_MEMFB_FONT_CHAR_LAST)) {
+    nCh = '?';
+  }
+  return nCh;
+}
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// =======================================================================
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvInit(gslc_tsGui* pGui)
+{
+  // Primary surface definitions
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+
+  if (pGui->pvDriver == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit(%s) called with NULL driver\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  pDriver->pFrameBuf      = NULL;
+  pDriver->pSpriteSel     = NULL;
+  pDriver->nBytesPerPixel = (DRV_MEMFB_DEPTH == 16)? 2 : 3;
+  pDriver->nColBkgnd      = GSLC_COL_BLACK;
+  pDriver->nFrameCnt      = 0;
+  pDriver->pfuncFlush     = NULL;
+  pDriver->pShadowBuf     = NULL;
+  pDriver->bShadowOwned   = false;
+  pDriver->bShadowValid   = false;
+  pDriver->nTouchHead     = 0;
+  pDriver->nTouchCnt      = 0;
+  memset(&pDriver->sStats,0,sizeof(pDriver->sStats));
+
+  // The framebuffer retains its content between frames,
+  // so partial redraw is supported
+  pGui->bRedrawPartialEn = true;
+
+  // Save a copy of the display dimensions
+  pGui->nDisp0W     = DRV_MEMFB_WIDTH;
+  pGui->nDisp0H     = DRV_MEMFB_HEIGHT;
+  pGui->nDispW      = DRV_MEMFB_WIDTH;
+  pGui->nDispH      = DRV_MEMFB_HEIGHT;
+  pGui->nDispDepth  = DRV_MEMFB_DEPTH;
+  pGui->nRotation   = 0;
+  pDriver->nStride  = (uint32_t)pGui->nDispW * pDriver->nBytesPerPixel;
+
+  // Allocate the framebuffer
+  pDriver->pFrameBuf = (uint8_t*)malloc((size_t)pDriver->nStride * pGui->nDispH);
+  if (pDriver->pFrameBuf == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvInit() failed to allocate %ux%u framebuffer\n",
+            pGui->nDispW,pGui->nDispH);
+    return false;
+  }
+  memset(pDriver->pFrameBuf,0,(size_t)pDriver->nStride * pGui->nDispH);
+
+  // Draw to the display and default to no clipping
+  gslc_DrvSpriteSelect(pGui,NULL);
+
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: Video mode: %u x %u x %u bit/pixel\n",
+          pGui->nDispW,pGui->nDispH,pGui->nDispDepth);
+  #endif
+
+  return true;
+}
+
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui)
+{
+  return (pGui->pvDriver);
+}
+
+void gslc_DrvDestruct(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver == NULL) {
+    return;
+  }
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+  if (pDriver->pFrameBuf) {
+    free(pDriver->pFrameBuf);
+    pDriver->pFrameBuf = NULL;
+  }
+  gslc_DrvSetFlushCb(pGui,NULL,NULL);
+}
+
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return m_acDrvDisp;
+}
+
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return m_acDrvTouch;
+}
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+// Image file access for gslc_BmpStreamOpen()
+typedef struct {
+  FILE*             pFile;    ///< Open image file
+  gslc_tsDrvStats*  pStats;   ///< Statistics to update
+} gslc_tsDrvFile;
+
+static int32_t gslc_DrvFileRead(void* pvFile,uint8_t* pBuf,uint16_t nLen)
+{
+  gslc_tsDrvFile* pDrvFile = (gslc_tsDrvFile*)pvFile;
+  pDrvFile->pStats->nCntFileRead++;
+  return (int32_t)fread(pBuf,1,nLen,pDrvFile->pFile);
+}
+
+static bool gslc_DrvFileSeek(void* pvFile,uint32_t nPos)
+{
+  gslc_tsDrvFile* pDrvFile = (gslc_tsDrvFile*)pvFile;
+  pDrvFile->pStats->nCntFileSeek++;
+  return (fseek(pDrvFile->pFile,(long)nPos,SEEK_SET) == 0);
+}
+
+// Load an uncompressed 24-bit or 32-bit BMP file into an RGB888 image
+// - The file is streamed with the same reader that the embedded
+//   drivers use for SD cards, so its behavior can be measured here
+static gslc_tsDrvImage* gslc_DrvLoadBmpFile(gslc_tsGui* pGui,const char* pStrFname)
+{
+  gslc_tsDriver*    pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvImage*  pImg    = NULL;
+  uint8_t*          pBuf    = NULL;
+  gslc_tsDrvFile    sDrvFile;
+  gslc_tsBmpStream  sStream;
+
+  sDrvFile.pStats = &pDriver->sStats;
+  sDrvFile.pFile  = fopen(pStrFname,"rb");
+  if (sDrvFile.pFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) failed to open\n",pStrFname);
+    return NULL;
+  }
+
+  pBuf = (uint8_t*)malloc(DRV_MEMFB_FILE_BUF);
+  if ((pBuf == NULL) ||
+      (!gslc_BmpStreamOpen(&sStream,&sDrvFile,&gslc_DrvFileRead,&gslc_DrvFileSeek,pBuf,DRV_MEMFB_FILE_BUF))) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) unsupported format\n",pStrFname);
+    free(pBuf);
+    fclose(sDrvFile.pFile);
+    return NULL;
+  }
+
+  pImg = (gslc_tsDrvImage*)malloc(sizeof(gslc_tsDrvImage));
+  if (pImg) {
+    pImg->nImgW   = (uint16_t)sStream.nImgW;
+    pImg->nImgH   = (uint16_t)sStream.nImgH;
+    pImg->pPixels = (uint8_t*)malloc((size_t)sStream.nImgW * sStream.nImgH * 3);
+  }
+  if ((pImg == NULL) || (pImg->pPixels == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) out of memory\n",pStrFname);
+    gslc_DrvImageDestruct(pImg);
+    free(pBuf);
+    fclose(sDrvFile.pFile);
+    return NULL;
+  }
+
+  // Convert each run of pixels
+  int16_t         nX,nY;
+  uint16_t        nCnt,nInd;
+  uint16_t        nRowCnt = 0;
+  uint8_t         nPixBytes = sStream.nPixBytes;
+  const uint8_t*  pSrc;
+  while ((nCnt = gslc_BmpStreamRead(&sStream,&nX,&nY,&pSrc)) > 0) {
+    uint8_t* pDst = pImg->pPixels + ((size_t)nY * sStream.nImgW + nX) * 3;
+    for (nInd = 0; nInd < nCnt; nInd++) {
+      // BMP pixels are stored as B,G,R(,A)
+      pDst[0] = pSrc[2];
+      pDst[1] = pSrc[1];
+      pDst[2] = pSrc[0];
+      pDst += 3;
+      pSrc += nPixBytes;
+    }
+    if (nX + nCnt == sStream.nImgW) {
+      nRowCnt++;
+    }
+  }
+  if (nRowCnt != sStream.nImgH) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) truncated file\n",pStrFname);
+    gslc_DrvImageDestruct(pImg);
+    pImg = NULL;
+  }
+
+  free(pBuf);
+  fclose(sDrvFile.pFile);
+  return pImg;
+}
+
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return NULL;
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    // Load image from file system
+    return (void*)gslc_DrvLoadBmpFile(pGui,sImgRef.pFname);
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) {
+    return NULL;  // No image preload done
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG) {
+    return NULL;  // No image preload done
+  }
+
+  // Default
+  return NULL;
+}
+
+// Determine if an image reference requires preloading by DrvLoadImage()
+static bool gslc_DrvImageNeedsLoad(gslc_tsImgRef sImgRef)
+{
+  return ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE);
+}
+
+
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+
+  pGui->sImgRefBkgnd = sImgRef;
+  pGui->sImgRefBkgnd.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if ((gslc_DrvImageNeedsLoad(sImgRef)) && (pGui->sImgRefBkgnd.pvImgRaw == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetBkgndImage(%s) failed\n","");
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+    return false;
+  }
+
+  return true;
+}
+
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+    pDriver->nColBkgnd = nCol;
+  }
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image
+  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
+    pElem->sImgRefNorm = gslc_ResetImage();
+  }
+
+  pElem->sImgRefNorm = sImgRef;
+  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if ((gslc_DrvImageNeedsLoad(sImgRef)) && (pElem->sImgRefNorm.pvImgRaw == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
+    return false;
+  }
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image
+  if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
+    pElem->sImgRefGlow = gslc_ResetImage();
+  }
+
+  pElem->sImgRefGlow = sImgRef;
+  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if ((gslc_DrvImageNeedsLoad(sImgRef)) && (pElem->sImgRefGlow.pvImgRaw == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
+    return false;
+  }
+  return true;
+}
+
+
+void gslc_DrvImageDestruct(void* pvImg)
+{
+  if (pvImg == NULL) {
+    return;
+  }
+  gslc_tsDrvImage* pImg = (gslc_tsDrvImage*)pvImg;
+  if (pImg->pPixels) {
+    free(pImg->pPixels);
+    pImg->pPixels = NULL;
+  }
+  free(pImg);
+}
+
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect    rDisp   = (gslc_tsRect){0,0,pDriver->nDrawW,pDriver->nDrawH};
+  if (pRect == NULL) {
+    // Default to entire display (or sprite)
+    pDriver->rClipRect = rDisp;
+  } else {
+    // The clipping region must always remain within the
+    // bounds of the drawing target as it guards all memory writes
+    pDriver->rClipRect = *pRect;
+    if ((pRect->w == 0) || (pRect->h == 0) || (!gslc_ClipRect(&rDisp,&pDriver->rClipRect))) {
+      pDriver->rClipRect = (gslc_tsRect){0,0,0,0};
+    }
+  }
+  return true;
+}
+
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz)
+{
+  (void)eFontRefType; // Unused
+  (void)nFontSz; // Unused
+  // All text is rendered with the built-in font, so the font
+  // reference is simply retained. The scale is derived from the
+  // font size during rendering.
+  return pvFontRef;
+}
+
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  // Nothing to deallocate
+}
+
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  (void)pGui; // Unused
+  // No offset coordinates used
+  *pnTxtX   = 0;
+  *pnTxtY   = 0;
+  *pnTxtSzW = 0;
+  *pnTxtSzH = 0;
+  if ((pFont == NULL) || (pStr == NULL)) {
+    return false;
+  }
+
+  uint8_t   nScale    = gslc_DrvFontScale(pFont);
+  uint16_t  nLineLen  = 0;
+  uint16_t  nLineMax  = 0;
+  uint16_t  nLines    = 1;
+
+  // Determine the longest row in a multi-line string
+  while (*pStr != '\0') {
+    if (*pStr == '\n') {
+      pStr++;
+      nLines++;
+      nLineLen = 0;
+      continue;
+    }
+    gslc_DrvFontNextChar(&pStr,eTxtFlags);
+    nLineLen++;
+    if (nLineLen > nLineMax) {
+      nLineMax = nLineLen;
+    }
+  }
+
+  *pnTxtSzW = nLineMax * DRV_MEMFB_FONT_CELL_W * nScale;
+  *pnTxtSzH = nLines * DRV_MEMFB_FONT_CELL_H * nScale;
+  return true;
+}
+
+
+// NOTE: The driver is compiled as pure C, so can't use default parameters.
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg)
+{
+  (void)colBg; // Unused
+  if ((pGui == NULL) || (pFont == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt(%s) with NULL ptr\n","");
+    return false;
+  }
+  if ((pStr == NULL) || (pStr[0] == '\0')) {
+    return true;
+  }
+
+  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t        nColRaw   = gslc_DrvAdaptColorRaw(colTxt);
+  pDriver->sStats.nCntTxt++;
+  uint8_t         nScale    = gslc_DrvFontScale(pFont);
+  int16_t         nCurX     = nTxtX;
+  int16_t         nCurY     = nTxtY;
+
+  while (*pStr != '\0') {
+    if (*pStr == '\n') {
+      pStr++;
+      nCurX  = nTxtX;
+      nCurY += DRV_MEMFB_FONT_CELL_H * nScale;
+      continue;
+    }
+    uint8_t         nCh     = gslc_DrvFontNextChar(&pStr,eTxtFlags);
+    const uint8_t*  pGlyph  = &m_anFontGlyph[(nCh - DRV_MEMFB_FONT_CHAR_FIRST) * DRV_MEMFB_FONT_GLYPH_W];
+
+    for (int16_t nCol = 0; nCol < DRV_MEMFB_FONT_GLYPH_W; nCol++) {
+      uint8_t nBits = pGlyph[nCol];
+      for (int16_t nRow = 0; nBits != 0; nRow++, nBits >>= 1) {
+        if ((nBits & 1) == 0) {
+          continue;
+        }
+        if (nScale == 1) {
+          gslc_DrvDrawSetPixelRaw(pDriver,nCurX+nCol,nCurY+nRow,nColRaw);
+        } else {
+          gslc_tsRect rDot = (gslc_tsRect){nCurX+nCol*nScale,nCurY+nRow*nScale,nScale,nScale};
+          if (gslc_ClipRect(&pDriver->rClipRect,&rDot)) {
+            for (int16_t nDotY = 0; nDotY < rDot.h; nDotY++) {
+              gslc_DrvFillSpanRaw(pDriver,rDot.x,rDot.y+nDotY,rDot.w,nColRaw);
+            }
+          }
+        }
+      }
+    }
+    nCurX += DRV_MEMFB_FONT_CELL_W * nScale;
+  }
+
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+// Pass a changed region to the flush callback and record it
+// in the shadow copy
+static void gslc_DrvFlushRect(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t  nOfs    = (uint32_t)rRect.y * pDriver->nStride + (uint32_t)rRect.x * pDriver->nBytesPerPixel;
+  uint32_t  nRowLen = (uint32_t)rRect.w * pDriver->nBytesPerPixel;
+  (*pDriver->pfuncFlush)((void*)pGui,rRect,pDriver->pFrameBuf + nOfs,pDriver->nStride);
+  pDriver->sStats.nCntFlushRect++;
+  pDriver->sStats.nFlushPixels += (uint32_t)rRect.w * rRect.h;
+  for (uint16_t nRow = 0; nRow < rRect.h; nRow++) {
+    memcpy(pDriver->pShadowBuf + nOfs,pDriver->pFrameBuf + nOfs,nRowLen);
+    nOfs += pDriver->nStride;
+  }
+}
+
+// Flush the tiles that differ from the shadow copy
+// - Changed tiles that are adjacent within a tile row are joined
+//   into a run, and a run is extended downwards while the tile row
+//   below has a run with the same horizontal extent
+static void gslc_DrvFlushTiles(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t       nBpp    = pDriver->nBytesPerPixel;
+  uint32_t      nStride = pDriver->nStride;
+  gslc_tsRect*  pPrev   = pDriver->asFlushRun[0];
+  gslc_tsRect*  pCur    = pDriver->asFlushRun[1];
+  gslc_tsRect*  pSwap;
+  uint16_t      nPrev   = 0;
+  uint16_t      nCur,nInd,nPrevInd;
+  int16_t       nTileX,nTileY;
+  uint16_t      nTileW,nTileH,nRow;
+  bool          bChanged;
+
+  for (nTileY = 0; nTileY < pGui->nDispH; nTileY += DRV_MEMFB_TILE) {
+    nTileH = ((nTileY + DRV_MEMFB_TILE) > pGui->nDispH)? pGui->nDispH - nTileY : DRV_MEMFB_TILE;
+
+    // Find the runs of changed tiles in this tile row
+    nCur = 0;
+    for (nTileX = 0; nTileX < pGui->nDispW; nTileX += DRV_MEMFB_TILE) {
+      nTileW = ((nTileX + DRV_MEMFB_TILE) > pGui->nDispW)? pGui->nDispW - nTileX : DRV_MEMFB_TILE;
+      bChanged = !pDriver->bShadowValid;
+      uint32_t nOfs = (uint32_t)nTileY * nStride + (uint32_t)nTileX * nBpp;
+      for (nRow = 0; (!bChanged) && (nRow < nTileH); nRow++) {
+        bChanged = (memcmp(pDriver->pFrameBuf + nOfs,pDriver->pShadowBuf + nOfs,(size_t)nTileW * nBpp) != 0);
+        nOfs += nStride;
+      }
+      if (!bChanged) {
+        continue;
+      }
+      if ((nCur > 0) && (pCur[nCur-1].x + pCur[nCur-1].w == nTileX)) {
+        pCur[nCur-1].w += nTileW;
+      } else {
+        pCur[nCur++] = (gslc_tsRect) { nTileX, nTileY, nTileW, nTileH };
+      }
+    }
+
+    // Extend the runs from the tile row above that continue into
+    // this one and flush the others
+    for (nPrevInd = 0; nPrevInd < nPrev; nPrevInd++) {
+      for (nInd = 0; nInd < nCur; nInd++) {
+        if ((pCur[nInd].x == pPrev[nPrevInd].x) && (pCur[nInd].w == pPrev[nPrevInd].w)) {
+          break;
+        }
+      }
+      if (nInd < nCur) {
+        pCur[nInd].y  = pPrev[nPrevInd].y;
+        pCur[nInd].h += pPrev[nPrevInd].h;
+      } else {
+        gslc_DrvFlushRect(pGui,pPrev[nPrevInd]);
+      }
+    }
+    pSwap = pPrev;
+    pPrev = pCur;
+    pCur  = pSwap;
+    nPrev = nCur;
+  }
+  for (nPrevInd = 0; nPrevInd < nPrev; nPrevInd++) {
+    gslc_DrvFlushRect(pGui,pPrev[nPrevInd]);
+  }
+  pDriver->bShadowValid = true;
+}
+
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // Unless a panel is attached, the framebuffer is the display,
+  // so there is nothing to copy
+  if (pDriver->pfuncFlush != NULL) {
+    gslc_DrvFlushTiles(pGui);
+  }
+  pDriver->nFrameCnt++;
+  pDriver->sStats.nCntFlip++;
+}
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->sStats.nCntPoint++;
+  gslc_DrvDrawSetPixelRaw(pDriver,nX,nY,gslc_DrvAdaptColorRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t       nColRaw = gslc_DrvAdaptColorRaw(nCol);
+  uint16_t       nIndPt;
+  pDriver->sStats.nCntPoints++;
+  for (nIndPt=0;nIndPt<nNumPt;nIndPt++) {
+    gslc_DrvDrawSetPixelRaw(pDriver,asPt[nIndPt].x,asPt[nIndPt].y,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->sStats.nCntFillRect++;
+  gslc_DrvFillRectRaw(pDriver,rRect,gslc_DrvAdaptColorRaw(nCol));
+  return true;
+}
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->sStats.nCntFrameRect++;
+  if ((rRect.w == 0) || (rRect.h == 0)) { return true; }
+  uint32_t nColRaw = gslc_DrvAdaptColorRaw(nCol);
+  int16_t nX0 = rRect.x;
+  int16_t nY0 = rRect.y;
+  int16_t nX1 = rRect.x + rRect.w - 1;
+  int16_t nY1 = rRect.y + rRect.h - 1;
+  // Draw each edge as a one-pixel filled rectangle
+  gslc_DrvFillRectRaw(pDriver,(gslc_tsRect){nX0,nY0,rRect.w,1},nColRaw);
+  gslc_DrvFillRectRaw(pDriver,(gslc_tsRect){nX0,nY1,rRect.w,1},nColRaw);
+  if (rRect.h > 2) {
+    gslc_DrvFillRectRaw(pDriver,(gslc_tsRect){nX0,nY0+1,1,rRect.h-2},nColRaw);
+    gslc_DrvFillRectRaw(pDriver,(gslc_tsRect){nX1,nY0+1,1,rRect.h-2},nColRaw);
+  }
+  return true;
+}
+
+
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->sStats.nCntLine++;
+  gslc_DrvDrawLineRaw(pDriver,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorRaw(nCol));
+  return true;
+}
+
+bool gslc_DrvDrawLines(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t       nColRaw = gslc_DrvAdaptColorRaw(nCol);
+  uint16_t       nIndPt;
+  pDriver->sStats.nCntLines++;
+  for (nIndPt=1;nIndPt<nNumPt;nIndPt++) {
+    gslc_DrvDrawLineRaw(pDriver,asPt[nIndPt-1].x,asPt[nIndPt-1].y,asPt[nIndPt].x,asPt[nIndPt].y,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t       nColRaw = gslc_DrvAdaptColorRaw(nCol);
+  gslc_tsRect    rClip   = pDriver->rClipRect;
+  int16_t        nClipX1 = rClip.x + rClip.w - 1;
+  int16_t        nClipY1 = rClip.y + rClip.h - 1;
+  int16_t        nX0,nX1;
+  uint16_t       nIndSpan;
+  pDriver->sStats.nCntSpans++;
+  for (nIndSpan=0;nIndSpan<nNumSpan;nIndSpan++) {
+    // Clip each span against the clipping region
+    if ((asSpan[nIndSpan].y < rClip.y) || (asSpan[nIndSpan].y > nClipY1)) { continue; }
+    nX0 = (asSpan[nIndSpan].x0 < rClip.x)? rClip.x : asSpan[nIndSpan].x0;
+    nX1 = (asSpan[nIndSpan].x1 > nClipX1)? nClipX1 : asSpan[nIndSpan].x1;
+    if (nX0 > nX1) { continue; }
+    gslc_DrvFillSpanRaw(pDriver,nX0,asSpan[nIndSpan].y,(uint16_t)(nX1-nX0+1),nColRaw);
+  }
+  return true;
+}
+
+// Draw a 1-bit image (bitmap) at the specified (x,y) position from the
+// provided bitmap buffer using the foreground color defined in the
+// header (unset bits are transparent).
+//
+// Image array format:
+// - Width[15:8],  Width[7:0],
+// - Height[15:8], Height[7:0],
+// - ColorR[7:0],  ColorG[7:0],
+// - ColorB[7:0],  0x00,
+// - Monochrome bitmap follows...
+//
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
+ const unsigned char *pBitmap,bool bProgMem)
+{
+  (void)bProgMem; // PROGMEM is directly addressable in LINUX
+  gslc_tsDriver*        pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const unsigned char*  bmap_base = pBitmap;
+  int16_t               w,h;
+  gslc_tsColor          nCol;
+
+  // Read header
+  w       = *(bmap_base++) << 8;
+  w      |= *(bmap_base++) << 0;
+  h       = *(bmap_base++) << 8;
+  h      |= *(bmap_base++) << 0;
+  nCol.r  = *(bmap_base++);
+  nCol.g  = *(bmap_base++);
+  nCol.b  = *(bmap_base++);
+
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(nCol);
+  int16_t   i, j, byteWidth = (w + 7) / 8;
+  uint8_t   nByte = 0;
+
+  for(j=0; j<h; j++) {
+    for(i=0; i<w; i++) {
+      if(i & 7) nByte <<= 1;
+      else      nByte = bmap_base[j * byteWidth + i / 8];
+      if(nByte & 0x80) {
+        gslc_DrvDrawSetPixelRaw(pDriver,nDstX+i,nDstY+j,nColRaw);
+      }
+    }
+  }
+}
+
+// Expand an RGB565 pixel into a color
+static gslc_tsColor gslc_DrvColor565(uint16_t nPix565)
+{
+  gslc_tsColor nCol;
+  nCol.r = (nPix565 >> 8) & 0xF8;
+  nCol.g = (nPix565 >> 3) & 0xFC;
+  nCol.b = (nPix565 << 3) & 0xF8;
+  return nCol;
+}
+
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  (void)bProgMem; // PROGMEM is directly addressable in LINUX
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const uint16_t* pImage  = (const uint16_t*)pBitmap;
+  int16_t         h, w;
+  h = *(pImage++);
+  w = *(pImage++);
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: DrvDrawBmp24FromMem() w=%d h=%d\n", w, h);
+  #endif
+
+  // Image pixels are stored as RGB565
+  uint16_t nTransRaw = ((pGui->sTransCol.r & 0xF8) << 8) | ((pGui->sTransCol.g & 0xFC) << 3) | (pGui->sTransCol.b >> 3);
+  int row, col;
+  for (row=0; row<h; row++) { // For each scanline...
+    for (col=0; col<w; col++) { // For each pixel...
+      uint16_t nPix565 = *(pImage++);
+      // If transparency is enabled, check to see if pixel should be masked
+      if ((GSLC_BMP_TRANS_EN) && (nPix565 == nTransRaw)) {
+        continue;
+      }
+      gslc_tsColor nCol;
+      nCol.r = (nPix565 >> 8) & 0xF8;
+      nCol.g = (nPix565 >> 3) & 0xFC;
+      nCol.b = (nPix565 << 3) & 0xF8;
+      gslc_DrvDrawSetPixelRaw(pDriver,nDstX+col,nDstY+row,gslc_DrvAdaptColorRaw(nCol));
+    }
+  }
+}
+
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  (void)bProgMem; // PROGMEM is directly addressable in LINUX
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const uint16_t* pImage  = (const uint16_t*)pBitmap;
+  int16_t         h, w;
+  h = *(pImage++);
+  w = *(pImage++);
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: DrvDrawRle16FromMem() w=%d h=%d\n", w, h);
+  #endif
+
+  gslc_tsRect rClip   = pDriver->rClipRect;
+  int16_t     nClipX1 = rClip.x + rClip.w - 1;
+  int16_t     nClipY1 = rClip.y + rClip.h - 1;
+  int16_t     nImgX   = 0;
+  int16_t     nImgY   = 0;
+  int16_t     nX0,nX1,nY;
+  uint16_t    nRun,nCnt,nPix565;
+  bool        bRowVis;
+
+  while (nImgY < h) {
+    nRun = *(pImage++);
+    nCnt = nRun & GSLC_RLE16_CNT_MASK;
+    if ((nCnt == 0) || (nImgX + nCnt > w)) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawRle16FromMem() invalid run at row %d\n",nImgY);
+      return;
+    }
+    // Determine the visible portion of the run
+    nY      = nDstY + nImgY;
+    bRowVis = (nY >= rClip.y) && (nY <= nClipY1);
+    nX0     = nDstX + nImgX;
+    nX1     = nX0 + nCnt - 1;
+    if (nX0 < rClip.x) { nX0 = rClip.x; }
+    if (nX1 > nClipX1) { nX1 = nClipX1; }
+
+    switch (nRun & GSLC_RLE16_OP_MASK) {
+      case GSLC_RLE16_OP_COPY:
+        if (bRowVis) {
+          for (int16_t nX = nX0; nX <= nX1; nX++) {
+            nPix565 = pImage[nX - (nDstX + nImgX)];
+            gslc_DrvFillSpanRaw(pDriver,nX,nY,1,gslc_DrvAdaptColorRaw(gslc_DrvColor565(nPix565)));
+          }
+        }
+        pImage += nCnt;
+        break;
+      case GSLC_RLE16_OP_FILL:
+        // Solid runs become a single span
+        nPix565 = *(pImage++);
+        if ((bRowVis) && (nX0 <= nX1)) {
+          gslc_DrvFillSpanRaw(pDriver,nX0,nY,(uint16_t)(nX1-nX0+1),gslc_DrvAdaptColorRaw(gslc_DrvColor565(nPix565)));
+        }
+        break;
+      default:
+        // Transparent run: nothing to draw
+        break;
+    }
+
+    // Runs do not cross rows
+    nImgX += nCnt;
+    if (nImgX == w) {
+      nImgX = 0;
+      nImgY++;
+    }
+  }
+}
+
+// Paste a preloaded (RGB888) image into the framebuffer
+static void gslc_DrvPasteImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsDrvImage* pImg)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect     rDst    = (gslc_tsRect){nDstX,nDstY,pImg->nImgW,pImg->nImgH};
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rDst)) { return; }
+
+  for (int16_t nRow = rDst.y; nRow < rDst.y + rDst.h; nRow++) {
+    const uint8_t* pSrc = pImg->pPixels + ((size_t)(nRow - nDstY) * pImg->nImgW + (rDst.x - nDstX)) * 3;
+    for (int16_t nCol = rDst.x; nCol < rDst.x + rDst.w; nCol++, pSrc += 3) {
+      gslc_tsColor nCol888 = (gslc_tsColor){pSrc[0],pSrc[1],pSrc[2]};
+      if ((GSLC_BMP_TRANS_EN) && (gslc_ColorEqual(nCol888,pGui->sTransCol))) {
+        continue;
+      }
+      gslc_DrvFillSpanRaw(pDriver,nCol,nRow,1,gslc_DrvAdaptColorRaw(nCol888));
+    }
+  }
+}
+
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) with NULL ptr\n","");
+    return false;
+  }
+  ((gslc_tsDriver*)(pGui->pvDriver))->sStats.nCntImage++;
+
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return true;  // Nothing to do
+
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    // File-based images are preloaded
+    if (sImgRef.pvImgRaw == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) with NULL pvImgRaw\n","");
+      return false;
+    }
+    gslc_DrvPasteImage(pGui,nDstX,nDstY,(gslc_tsDrvImage*)sImgRef.pvImgRaw);
+    return true;
+
+  } else if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) ||
+             ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG)) {
+    bool bProgMem = ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG);
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW1) {
+      // Draw a monochrome bitmap from memory
+      // - Dimensions and output color are defined in arrray header
+      gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,bProgMem);
+      return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) {
+      // Bitmap in memory
+      gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,bProgMem);
+      return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Run-length encoded RGB565 image in memory
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,bProgMem);
+      return true;
+    } else {
+      return false; // TODO: not yet supported
+    }
+
+  } else {
+    // Unsupported source
+    GSLC_DEBUG2_PRINT("DBG: DrvDrawImage() unsupported source eImgFlags=%d\n", sImgRef.eImgFlags);
+    return false;
+  }
+}
+
+
+/// NOTE: Background image is stored in pGui->sImgRefBkgnd
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBkgnd(%s) with NULL ptr\n","");
+    return;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->sStats.nCntBkgnd++;
+
+  // Check to see if an image has been assigned to the background
+  if (pGui->sImgRefBkgnd.eImgFlags == GSLC_IMGREF_NONE) {
+    // No image assigned, so assume flat color background
+    // - The fill is constrained by the clipping region
+    gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+    gslc_DrvFillRectRaw(pDriver,rRect,gslc_DrvAdaptColorRaw(pDriver->nColBkgnd));
+  } else {
+    gslc_DrvDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+  }
+}
+
+
+uint32_t gslc_DrvReadRectLen(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return (uint32_t)rRect.w * rRect.h * pDriver->nBytesPerPixel;
+}
+
+bool gslc_DrvReadRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf)
+{
+  if ((pGui == NULL) || (pBuf == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvReadRect(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // The region must lie within the selected sprite or display
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+    (rRect.x + rRect.w > pDriver->nDrawW) || (rRect.y + rRect.h > pDriver->nDrawH)) {
+    return false;
+  }
+  pDriver->sStats.nCntReadRect++;
+
+  // Copy each row of the region out of the drawing target
+  uint32_t  nRowLen = (uint32_t)rRect.w * pDriver->nBytesPerPixel;
+  uint8_t*  pRow    = pDriver->pDrawBuf + (uint32_t)rRect.y * pDriver->nDrawStride + (uint32_t)rRect.x * pDriver->nBytesPerPixel;
+  for (uint16_t nRow = 0; nRow < rRect.h; nRow++) {
+    memcpy(pBuf,pRow,nRowLen);
+    pBuf += nRowLen;
+    pRow += pDriver->nDrawStride;
+  }
+  return true;
+}
+
+bool gslc_DrvWriteRect(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf)
+{
+  if ((pGui == NULL) || (pBuf == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvWriteRect(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // The region must lie within the selected sprite or display
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+    (rRect.x + rRect.w > pDriver->nDrawW) || (rRect.y + rRect.h > pDriver->nDrawH)) {
+    return false;
+  }
+  pDriver->sStats.nCntWriteRect++;
+  pDriver->sStats.nPixels += (uint32_t)rRect.w * rRect.h;
+
+  // Copy each row of the region back into the drawing target
+  uint32_t  nRowLen = (uint32_t)rRect.w * pDriver->nBytesPerPixel;
+  uint8_t*  pRow    = pDriver->pDrawBuf + (uint32_t)rRect.y * pDriver->nDrawStride + (uint32_t)rRect.x * pDriver->nBytesPerPixel;
+  for (uint16_t nRow = 0; nRow < rRect.h; nRow++) {
+    memcpy(pRow,pBuf,nRowLen);
+    pBuf += nRowLen;
+    pRow += pDriver->nDrawStride;
+  }
+  return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Sprite Functions
+// ------------------------------------------------------------------------
+
+bool gslc_DrvSpriteCreate(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,uint16_t nW,uint16_t nH)
+{
+  if ((pGui == NULL) || (pSprite == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pSprite->nW       = nW;
+  pSprite->nH       = nH;
+  pSprite->pPixels  = NULL;
+  if ((nW == 0) || (nH == 0)) {
+    return false;
+  }
+  pSprite->pPixels = (uint8_t*)calloc((size_t)nW * nH,pDriver->nBytesPerPixel);
+  if (pSprite->pPixels == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate() failed to allocate %ux%u sprite\n",nW,nH);
+    return false;
+  }
+  return true;
+}
+
+void gslc_DrvSpriteDestruct(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite)
+{
+  if ((pGui == NULL) || (pSprite == NULL)) {
+    return;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSpriteSel == pSprite) {
+    gslc_DrvSpriteSelect(pGui,NULL);
+  }
+  if (pSprite->pPixels) {
+    free(pSprite->pPixels);
+    pSprite->pPixels = NULL;
+  }
+}
+
+bool gslc_DrvSpriteSelect(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pSprite == NULL) {
+    pDriver->pDrawBuf     = pDriver->pFrameBuf;
+    pDriver->nDrawStride  = pDriver->nStride;
+    pDriver->nDrawW       = pGui->nDispW;
+    pDriver->nDrawH       = pGui->nDispH;
+  } else {
+    if (pSprite->pPixels == NULL) {
+      return false;
+    }
+    pDriver->pDrawBuf     = pSprite->pPixels;
+    pDriver->nDrawStride  = (uint32_t)pSprite->nW * pDriver->nBytesPerPixel;
+    pDriver->nDrawW       = pSprite->nW;
+    pDriver->nDrawH       = pSprite->nH;
+  }
+  pDriver->pSpriteSel = pSprite;
+  gslc_DrvSetClipRect(pGui,NULL);
+  return true;
+}
+
+bool gslc_DrvSpritePush(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,int16_t nDstX,int16_t nDstY)
+{
+  if ((pGui == NULL) || (pSprite == NULL) || (pSprite->pPixels == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpritePush(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSpriteSel != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpritePush() called while a sprite is selected%s\n","");
+    return false;
+  }
+  pDriver->sStats.nCntSpritePush++;
+
+  // Copy the rows of the sprite that lie within the clipping region
+  gslc_tsRect rDst = (gslc_tsRect) { nDstX, nDstY, pSprite->nW, pSprite->nH };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rDst)) {
+    return true;
+  }
+  uint8_t   nBpp       = pDriver->nBytesPerPixel;
+  uint32_t  nSrcStride = (uint32_t)pSprite->nW * nBpp;
+  uint32_t  nRowLen    = (uint32_t)rDst.w * nBpp;
+  uint8_t*  pSrc       = pSprite->pPixels + (uint32_t)(rDst.y - nDstY) * nSrcStride + (uint32_t)(rDst.x - nDstX) * nBpp;
+  uint8_t*  pDst       = pDriver->pFrameBuf + (uint32_t)rDst.y * pDriver->nStride + (uint32_t)rDst.x * nBpp;
+  pDriver->sStats.nPixels += (uint32_t)rDst.w * rDst.h;
+  for (uint16_t nRow = 0; nRow < rDst.h; nRow++) {
+    memcpy(pDst,pSrc,nRowLen);
+    pSrc += nSrcStride;
+    pDst += pDriver->nStride;
+  }
+  return true;
+}
+
+
+
+// ------------------------------------------------------------------------
+// Touch Functions (via injected events)
+// ------------------------------------------------------------------------
+
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev)
+{
+  (void)acDev; // Unused
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInitTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nTouchHead = 0;
+  pDriver->nTouchCnt  = 0;
+  // Injected touch events are handled by default
+  pGui->bTouchEn = true;
+  return true;
+}
+
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return NULL;
+}
+
+
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
+{
+  (void)pnInputVal; // Unused
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvGetTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  *peInputEvent = GSLC_INPUT_NONE;
+  if (pDriver->nTouchCnt == 0) {
+    return false;
+  }
+
+  // Dequeue the oldest touch event
+  gslc_tsDrvTouch* pTouch = &pDriver->asTouch[pDriver->nTouchHead];
+  *pnX          = pTouch->nX;
+  *pnY          = pTouch->nY;
+  *pnPress      = pTouch->nPress;
+  *peInputEvent = GSLC_INPUT_TOUCH;
+  pDriver->nTouchHead = (pDriver->nTouchHead + 1) % DRV_MEMFB_TOUCH_QUEUE;
+  pDriver->nTouchCnt--;
+  return true;
+}
+
+
+/// Change display rotation
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // Did the orientation change?
+  if (nRotation == pGui->nRotation) {
+    return false;
+  }
+
+  // The framebuffer is simply reinterpreted with the
+  // new dimensions. A full redraw is required.
+  bool bSwap = ((nRotation == 1) || (nRotation == 3));
+  pGui->nRotation = nRotation;
+  pGui->nDispW    = (bSwap)? pGui->nDisp0H : pGui->nDisp0W;
+  pGui->nDispH    = (bSwap)? pGui->nDisp0W : pGui->nDisp0H;
+  pDriver->nStride = (uint32_t)pGui->nDispW * pDriver->nBytesPerPixel;
+  pDriver->bShadowValid = false;
+  gslc_DrvSpriteSelect(pGui,NULL);
+
+  return true;
+}
+
+
+// =======================================================================
+// Public APIs specific to this driver
+// =======================================================================
+
+uint8_t* gslc_DrvGetFrameBuf(gslc_tsGui* pGui,uint32_t* pnStride)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pnStride) {
+    *pnStride = pDriver->nStride;
+  }
+  return pDriver->pFrameBuf;
+}
+
+gslc_tsColor gslc_DrvGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsColor   nCol    = GSLC_COL_BLACK;
+  if ((pDriver->pFrameBuf == NULL) || (nX < 0) || (nY < 0) || (nX >= pGui->nDispW) || (nY >= pGui->nDispH)) {
+    return nCol;
+  }
+  uint8_t* pPix = pDriver->pFrameBuf + (uint32_t)nY * pDriver->nStride + (uint32_t)nX * pDriver->nBytesPerPixel;
+  #if (DRV_MEMFB_DEPTH == 16)
+    uint16_t nPix565 = *(uint16_t*)pPix;
+    nCol.r = (nPix565 >> 8) & 0xF8;
+    nCol.g = (nPix565 >> 3) & 0xFC;
+    nCol.b = (nPix565 << 3) & 0xF8;
+  #else
+    nCol.r = pPix[0];
+    nCol.g = pPix[1];
+    nCol.b = pPix[2];
+  #endif
+  return nCol;
+}
+
+bool gslc_DrvSaveFrame(gslc_tsGui* pGui,const char* pFname)
+{
+  FILE* pFile = fopen(pFname,"wb");
+  if (pFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSaveFrame(%s) failed to open\n",pFname);
+    return false;
+  }
+  fprintf(pFile,"P6\n%u %u\n255\n",pGui->nDispW,pGui->nDispH);
+  for (int16_t nY = 0; nY < pGui->nDispH; nY++) {
+    for (int16_t nX = 0; nX < pGui->nDispW; nX++) {
+      gslc_tsColor nCol = gslc_DrvGetPixel(pGui,nX,nY);
+      fputc(nCol.r,pFile);
+      fputc(nCol.g,pFile);
+      fputc(nCol.b,pFile);
+    }
+  }
+  fclose(pFile);
+  return true;
+}
+
+bool gslc_DrvInjectTouch(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nPress)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->nTouchCnt >= DRV_MEMFB_TOUCH_QUEUE) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInjectTouch(%s) queue full\n","");
+    return false;
+  }
+  uint8_t nInd = (pDriver->nTouchHead + pDriver->nTouchCnt) % DRV_MEMFB_TOUCH_QUEUE;
+  pDriver->asTouch[nInd].nX     = nX;
+  pDriver->asTouch[nInd].nY     = nY;
+  pDriver->asTouch[nInd].nPress = nPress;
+  pDriver->nTouchCnt++;
+  return true;
+}
+
+void gslc_DrvGetStats(gslc_tsGui* pGui,gslc_tsDrvStats* pStats)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  *pStats = pDriver->sStats;
+}
+
+void gslc_DrvResetStats(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  memset(&pDriver->sStats,0,sizeof(pDriver->sStats));
+}
+
+bool gslc_DrvSetFlushCb(gslc_tsGui* pGui,GSLC_CB_DRV_FLUSH pfuncFlush,uint8_t* pShadowBuf)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->bShadowOwned) {
+    free(pDriver->pShadowBuf);
+  }
+  pDriver->pfuncFlush   = NULL;
+  pDriver->pShadowBuf   = NULL;
+  pDriver->bShadowOwned = false;
+  pDriver->bShadowValid = false;
+  if (pfuncFlush == NULL) {
+    return true;
+  }
+  if (pShadowBuf == NULL) {
+    pShadowBuf = (uint8_t*)malloc((size_t)pDriver->nStride * pGui->nDispH);
+    if (pShadowBuf == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvSetFlushCb() failed to allocate %ux%u shadow buffer\n",
+              pGui->nDispW,pGui->nDispH);
+      return false;
+    }
+    pDriver->bShadowOwned = true;
+  }
+  pDriver->pfuncFlush = pfuncFlush;
+  pDriver->pShadowBuf = pShadowBuf;
+  return true;
+}
+
+
+// =======================================================================
+// Private Functions
+// =======================================================================
+
+uint32_t gslc_DrvAdaptColorRaw(gslc_tsColor nCol)
+{
+  #if (DRV_MEMFB_DEPTH == 16)
+    return ((nCol.r & 0xF8) << 8) | ((nCol.g & 0xFC) << 3) | (nCol.b >> 3);
+  #else
+    return ((uint32_t)nCol.r << 16) | ((uint32_t)nCol.g << 8) | nCol.b;
+  #endif
+}
+
+void gslc_DrvFillSpanRaw(gslc_tsDriver* pDriver,int16_t nX,int16_t nY,uint16_t nW,uint32_t nColRaw)
+{
+  uint8_t* pPix = pDriver->pDrawBuf + (uint32_t)nY * pDriver->nDrawStride + (uint32_t)nX * pDriver->nBytesPerPixel;
+  pDriver->sStats.nPixels += nW;
+  #if (DRV_MEMFB_DEPTH == 16)
+    uint16_t* pPix16 = (uint16_t*)pPix;
+    while (nW--) {
+      *(pPix16++) = (uint16_t)nColRaw;
+    }
+  #else
+    uint8_t nR = (nColRaw >> 16) & 0xFF;
+    uint8_t nG = (nColRaw >>  8) & 0xFF;
+    uint8_t nB = (nColRaw >>  0) & 0xFF;
+    while (nW--) {
+      *(pPix++) = nR;
+      *(pPix++) = nG;
+      *(pPix++) = nB;
+    }
+  #endif
+}
+
+void gslc_DrvFillRectRaw(gslc_tsDriver* pDriver,gslc_tsRect rRect,uint32_t nColRaw)
+{
+  if ((rRect.w == 0) || (rRect.h == 0)) { return; }
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return; }
+  for (int16_t nRow = 0; nRow < rRect.h; nRow++) {
+    gslc_DrvFillSpanRaw(pDriver,rRect.x,rRect.y+nRow,rRect.w,nColRaw);
+  }
+}
+
+void gslc_DrvDrawSetPixelRaw(gslc_tsDriver* pDriver,int16_t nX,int16_t nY,uint32_t nColRaw)
+{
+  // Clipping is always performed as it also bounds the framebuffer
+  if (!gslc_ClipPt(&pDriver->rClipRect,nX,nY)) { return; }
+  gslc_DrvFillSpanRaw(pDriver,nX,nY,1,nColRaw);
+}
+
+void gslc_DrvDrawLineRaw(gslc_tsDriver* pDriver,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw)
+{
+  // Horizontal and vertical lines are drawn as filled rectangles
+  if (nY0 == nY1) {
+    if (nX1 < nX0) { int16_t nTmp = nX0; nX0 = nX1; nX1 = nTmp; }
+    gslc_DrvFillRectRaw(pDriver,(gslc_tsRect){nX0,nY0,nX1-nX0+1,1},nColRaw);
+    return;
+  }
+  if (nX0 == nX1) {
+    if (nY1 < nY0) { int16_t nTmp = nY0; nY0 = nY1; nY1 = nTmp; }
+    gslc_DrvFillRectRaw(pDriver,(gslc_tsRect){nX0,nY0,1,nY1-nY0+1},nColRaw);
+    return;
+  }
+
+  // Clip the line to the clipping region
+  if (!gslc_ClipLine(&pDriver->rClipRect,&nX0,&nY0,&nX1,&nY1)) { return; }
+
+  // Bresenham line
+  int16_t   nDX     = (nX1 > nX0)? (nX1 - nX0) : (nX0 - nX1);
+  int16_t   nDY     = (nY1 > nY0)? (nY0 - nY1) : (nY1 - nY0);
+  int16_t   nSX     = (nX0 < nX1)? 1 : -1;
+  int16_t   nSY     = (nY0 < nY1)? 1 : -1;
+  int32_t   nErr    = nDX + nDY;
+  int32_t   nErr2;
+  while (true) {
+    gslc_DrvDrawSetPixelRaw(pDriver,nX0,nY0,nColRaw);
+    if ((nX0 == nX1) && (nY0 == nY1)) { break; }
+    nErr2 = 2 * nErr;
+    if (nErr2 >= nDY) { nErr += nDY; nX0 += nSX; }
+    if (nErr2 <= nDX) { nErr += nDX; nY0 += nSY; }
+  }
+}
+
+
+#endif // Compiler guard for requested driver
@@ -0,0 +1,917 @@
+#ifndef _GUISLICE_DRV_MEMFB_H_
+#define _GUISLICE_DRV_MEMFB_H_
+
+// =======================================================================
+// GUIslice library (driver layer for headless memory framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_memfb.h
+/// \brief GUIslice library (driver layer for headless memory framebuffer)
+
+
+// =======================================================================
+// Driver Layer for headless memory framebuffer
+// - All drawing is performed in software into a RAM buffer
+//   (RGB565 or RGB888). No display, windowing system or
+//   framebuffer device is required.
+// - Intended for automated testing, soak tests and measuring
+//   the rendering cost of the GUIslice core.
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+
+#include <stdio.h>
+
+// =======================================================================
+// Driver configuration defaults
+// - These may be overridden in the user config file
+// =======================================================================
+
+#ifndef DRV_MEMFB_WIDTH
+  #define DRV_MEMFB_WIDTH           480   ///< Native display width (pixels)
+#endif
+#ifndef DRV_MEMFB_HEIGHT
+  #define DRV_MEMFB_HEIGHT          320   ///< Native display height (pixels)
+#endif
+#ifndef DRV_MEMFB_DEPTH
+  #define DRV_MEMFB_DEPTH           16    ///< Pixel depth: 16 (RGB565) or 24 (RGB888)
+#endif
+#ifndef DRV_MEMFB_TOUCH_QUEUE
+  #define DRV_MEMFB_TOUCH_QUEUE     8     ///< Max number of queued (injected) touch events
+#endif
+#ifndef DRV_MEMFB_FILE_BUF
+  #define DRV_MEMFB_FILE_BUF        4096  ///< Buffer size for streaming image files (bytes)
+#endif
+#ifndef DRV_MEMFB_TILE
+  #define DRV_MEMFB_TILE            16    ///< Tile size (pixels) for finding changes to flush
+#endif
+
+/// Maximum number of tiles across the display in any orientation
+#define DRV_MEMFB_TILE_COLS \
+  ((((DRV_MEMFB_WIDTH > DRV_MEMFB_HEIGHT)? DRV_MEMFB_WIDTH : DRV_MEMFB_HEIGHT) + DRV_MEMFB_TILE - 1) / DRV_MEMFB_TILE)
+
+#if (DRV_MEMFB_DEPTH != 16) && (DRV_MEMFB_DEPTH != 24)
+  #error DRV_MEMFB_DEPTH must be 16 (RGB565) or 24 (RGB888)
+#endif
+
+// =======================================================================
+// API support definitions
+// - These defines indicate whether the driver includes optimized
+//   support for various APIs. If a define is set to 0, then the
+//   GUIslice core emulation will be used instead.
+// - At the very minimum, the point draw routine must be available:
+//   gslc_DrvDrawPoint()
+// =======================================================================
+
+#define DRV_HAS_DRAW_POINT             1 ///< Support gslc_DrvDrawPoint()
+
+#define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_LINES             1 ///< Support gslc_DrvDrawLines()
+#define DRV_HAS_DRAW_SPANS             1 ///< Support gslc_DrvDrawSpans()
+#define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
+#define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FILL   0 ///< Support gslc_DrvDrawFillRoundRect()
+#define DRV_HAS_DRAW_CIRCLE_FRAME      0 ///< Support gslc_DrvDrawFrameCircle()
+#define DRV_HAS_DRAW_CIRCLE_FILL       0 ///< Support gslc_DrvDrawFillCircle()
+#define DRV_HAS_DRAW_TRI_FRAME         0 ///< Support gslc_DrvDrawFrameTriangle()
+#define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
+#define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
+#define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+
+#define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
+#define DRV_HAS_REDRAW_BATCH           0 ///< Support gslc_DrvRedrawBegin() / gslc_DrvRedrawEnd()
+#define DRV_HAS_READ_RECT              1 ///< Support gslc_DrvReadRect() / gslc_DrvWriteRect()
+#define DRV_HAS_SPRITE                 1 ///< Support gslc_DrvSpriteCreate() and off-screen drawing
+
+// =======================================================================
+// Driver-specific members
+// =======================================================================
+
+/// Image loaded from the file system (decoded to RGB888)
+typedef struct {
+  uint16_t            nImgW;            ///< Image width
+  uint16_t            nImgH;            ///< Image height
+  uint8_t*            pPixels;          ///< Pixel data (R,G,B per pixel, top row first)
+} gslc_tsDrvImage;
+
+/// Off-screen drawing surface (sprite)
+typedef struct {
+  uint16_t            nW;               ///< Width of the sprite
+  uint16_t            nH;               ///< Height of the sprite
+  uint8_t*            pPixels;          ///< Pixel data in the framebuffer format (NULL if not created)
+} gslc_tsDrvSprite;
+
+/// Callback function for pushing a changed region of the framebuffer
+/// to a display panel
+/// - pPixels points to the top-left pixel of rRect within the framebuffer
+///   and nStride is the number of bytes between framebuffer rows
+typedef void (*GSLC_CB_DRV_FLUSH)(void* pvGui,gslc_tsRect rRect,const uint8_t* pPixels,uint32_t nStride);
+
+/// Injected touch event
+typedef struct {
+  int16_t             nX;               ///< X coordinate
+  int16_t             nY;               ///< Y coordinate
+  uint16_t            nPress;           ///< Pressure (0 for release)
+} gslc_tsDrvTouch;
+
+/// Drawing statistics
+/// - Call counts refer to the driver primitives invoked by the
+///   GUIslice core (internal decomposition is not counted)
+typedef struct {
+  uint32_t            nCntPoint;        ///< Calls to gslc_DrvDrawPoint()
+  uint32_t            nCntPoints;       ///< Calls to gslc_DrvDrawPoints()
+  uint32_t            nCntLine;         ///< Calls to gslc_DrvDrawLine()
+  uint32_t            nCntLines;        ///< Calls to gslc_DrvDrawLines()
+  uint32_t            nCntSpans;        ///< Calls to gslc_DrvDrawSpans()
+  uint32_t            nCntFrameRect;    ///< Calls to gslc_DrvDrawFrameRect()
+  uint32_t            nCntFillRect;     ///< Calls to gslc_DrvDrawFillRect()
+  uint32_t            nCntTxt;          ///< Calls to gslc_DrvDrawTxt()
+  uint32_t            nCntImage;        ///< Calls to gslc_DrvDrawImage()
+  uint32_t            nCntBkgnd;        ///< Calls to gslc_DrvDrawBkgnd()
+  uint32_t            nCntFlip;         ///< Calls to gslc_DrvPageFlipNow()
+  uint32_t            nCntFileRead;     ///< Reads from image files
+  uint32_t            nCntFileSeek;     ///< Seeks within image files
+  uint32_t            nCntReadRect;     ///< Calls to gslc_DrvReadRect()
+  uint32_t            nCntWriteRect;    ///< Calls to gslc_DrvWriteRect()
+  uint32_t            nCntSpritePush;   ///< Calls to gslc_DrvSpritePush()
+  uint32_t            nCntFlushRect;    ///< Regions passed to the flush callback
+  uint64_t            nPixels;          ///< Number of pixels written to the framebuffer
+  uint64_t            nFlushPixels;     ///< Number of pixels passed to the flush callback
+} gslc_tsDrvStats;
+
+typedef struct {
+  uint8_t*            pFrameBuf;        ///< Pixel buffer (nDisp0W x nDisp0H)
+  uint8_t             nBytesPerPixel;   ///< Bytes per pixel (2 for RGB565, 3 for RGB888)
+  uint32_t            nStride;          ///< Bytes per row in the current orientation
+
+  uint8_t*            pDrawBuf;         ///< Pixel buffer that drawing is directed to
+  uint32_t            nDrawStride;      ///< Bytes per row in pDrawBuf
+  uint16_t            nDrawW;           ///< Width of pDrawBuf
+  uint16_t            nDrawH;           ///< Height of pDrawBuf
+  gslc_tsDrvSprite*   pSpriteSel;       ///< Sprite that drawing is directed to (NULL for the display)
+
+  gslc_tsColor        nColBkgnd;        ///< Background color (if not image-based)
+  gslc_tsRect         rClipRect;        ///< Clipping rectangle (always within the drawing target)
+
+  uint32_t            nFrameCnt;        ///< Number of page flips performed
+
+  GSLC_CB_DRV_FLUSH   pfuncFlush;       ///< Callback for flushing changes to a panel (or NULL)
+  uint8_t*            pShadowBuf;       ///< Copy of the framebuffer as last flushed
+  bool                bShadowOwned;     ///< pShadowBuf was allocated by the driver
+  bool                bShadowValid;     ///< pShadowBuf matches the panel contents
+  gslc_tsRect         asFlushRun[2][DRV_MEMFB_TILE_COLS]; ///< Changed tile runs in the current and previous tile rows
+
+  gslc_tsDrvTouch     asTouch[DRV_MEMFB_TOUCH_QUEUE]; ///< Queue of injected touch events
+  uint8_t             nTouchHead;       ///< Index of the oldest queued touch event
+  uint8_t             nTouchCnt;        ///< Number of queued touch events
+
+  gslc_tsDrvStats     sStats;           ///< Drawing statistics
+
+} gslc_tsDriver;
+
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// - These functions define the renderer / driver-dependent
+//   implementations for the core drawing operations within
+//   GUIslice.
+// =======================================================================
+
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+///
+/// Initialize the memory framebuffer driver
+/// - Allocates the framebuffer according to DRV_MEMFB_WIDTH,
+///   DRV_MEMFB_HEIGHT and DRV_MEMFB_DEPTH
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvInit(gslc_tsGui* pGui);
+
+
+///
+/// Free up any members associated with the driver
+/// - Eg. framebuffer, background image, etc.
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the display driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui);
+
+
+///
+/// Get the touch driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui);
+
+///
+/// Get the native display driver instance
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the display driver instance
+///         (gslc_tsDriver*)
+///
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui);
+
+///
+/// Get the native touch driver instance
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return NULL as no touch driver instance is created
+///
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+
+///
+/// Load a bitmap (*.bmp) and create a new image resource.
+/// - Only file-based images are preloaded. Images in RAM or
+///   FLASH are rendered directly from their buffers.
+/// - Transparency is enabled by GSLC_BMP_TRANS_EN
+///   through use of color (GSLC_BMP_TRANS_RGB).
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Image pointer (gslc_tsDrvImage*) or NULL if error / not preloaded
+///
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a bitmap image
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+///
+/// Configure the background to use a solid color
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        RGB Color to use
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+///
+/// Set an element's normal-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+///
+/// Set an element's glow-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Release an image surface
+///
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return none
+///
+void gslc_DrvImageDestruct(void* pvImg);
+
+
+///
+/// Set the clipping rectangle for future drawing updates
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pRect:         Rectangular region to constrain edits
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+
+///
+/// Load a font from a resource and return pointer to it
+/// - This driver renders all text with a built-in 5x7 font
+///   (6x8 cell). The typeface size selects the scale factor:
+///   - GSLC_FONTREF_PTR:   nFontSz is the integer scale factor
+///   - GSLC_FONTREF_FNAME: nFontSz is a point size; the font file
+///                         is not opened and the scale is nFontSz/8
+///
+/// \param[in]  eFontRefType:   Font reference type
+/// \param[in]  pvFontRef:      Font reference pointer (unused)
+/// \param[in]  nFontSz:        Typeface size to use
+///
+/// \return Void ptr to the font reference (may be NULL)
+///
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz);
+
+///
+/// Release all fonts defined in the GUI
+///
+/// \param[in]  pGui:          Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the extent (width and height) of a text string
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font structure
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtX:      Ptr to offset X of text
+/// \param[out] pnTxtY:      Ptr to offset Y of text
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+
+///
+/// Draw a text string at the given coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pFont:       Ptr to Font
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+/// \param[in]  colBg:       unused (text is rendered transparently)
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+///
+/// Force a page flip to occur
+/// - The framebuffer is not double-buffered, so this only
+///   updates the frame counter
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of point
+/// \param[in]  nY:          Y coordinate of point
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to draw
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw a framed rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a line
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+///
+/// Draw a series of connected lines
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to connect
+/// \param[in]  nNumPt:      Number of points in array (at least 2)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLines(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Fill a series of horizontal spans
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans (x0 <= x1, inclusive)
+/// \param[in]  nNumSpan:    Number of spans in array
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol);
+
+
+///
+/// Copy all of source image to destination screen at specified coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef);
+
+
+///
+/// Draw a monochrome bitmap from a memory array
+/// - Draw from the bitmap buffer using the foreground color
+///   defined in the header (unset bits are transparent)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, const unsigned char *pBitmap,bool bProgMem);
+
+
+///
+/// Draw a color 16-bit (RGB565) bitmap from a memory array
+/// - The first two words of the array define the height and width
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
+///
+/// Draw a run-length encoded RGB565 bitmap from a memory array
+/// - See GSLC_IMGREF_FMT_RLE16 for the array format
+/// - Solid runs are filled as spans and transparent runs are skipped
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
+
+///
+/// Copy the background image to destination screen
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
+
+
+///
+/// Get the buffer size required by gslc_DrvReadRect() for a region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display
+///
+/// \return Number of bytes required
+///
+uint32_t gslc_DrvReadRectLen(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
+///
+/// Copy a region of the display into a buffer
+/// - Reads from the sprite selected by gslc_DrvSpriteSelect() if any
+/// - The pixels are stored row by row in the driver's native format
+/// - The region must lie within the display (or the selected sprite)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display to read
+/// \param[out] pBuf:        Buffer of at least gslc_DrvReadRectLen() bytes
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvReadRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf);
+
+
+///
+/// Write a buffer captured by gslc_DrvReadRect() back to the display
+/// - Writes to the sprite selected by gslc_DrvSpriteSelect() if any
+/// - The clipping region is not applied
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display to write
+/// \param[in]  pBuf:        Buffer from gslc_DrvReadRect() for the same region
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvWriteRect(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf);
+
+
+// -----------------------------------------------------------------------
+// Sprite Functions
+// -----------------------------------------------------------------------
+
+///
+/// Create an off-screen drawing surface (sprite)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pSprite:     Pointer to sprite to initialize
+/// \param[in]  nW:          Width of the sprite
+/// \param[in]  nH:          Height of the sprite
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpriteCreate(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,uint16_t nW,uint16_t nH);
+
+
+///
+/// Release the resources associated with a sprite
+/// - If the sprite is selected, drawing reverts to the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite
+///
+/// \return none
+///
+void gslc_DrvSpriteDestruct(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite);
+
+
+///
+/// Direct all subsequent drawing to a sprite or back to the display
+/// - While a sprite is selected, drawing coordinates are relative
+///   to the top-left corner of the sprite
+/// - The clipping region is reset to the whole of the new target
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite (or NULL for the display)
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpriteSelect(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite);
+
+
+///
+/// Copy the contents of a sprite to the display
+/// - The display must be the current drawing target
+/// - The copy is limited by the clipping region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite
+/// \param[in]  nDstX:       X coordinate of the top-left corner on the display
+/// \param[in]  nDstY:       Y coordinate of the top-left corner on the display
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpritePush(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,int16_t nDstX,int16_t nDstY);
+
+
+// -----------------------------------------------------------------------
+// Touch Functions
+// -----------------------------------------------------------------------
+
+///
+/// Perform any touchscreen-specific initialization
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  acDev:       Device path (unused)
+///
+/// \return true if successful
+///
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev);
+
+
+///
+/// Get the next touch event from the injected touch queue
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnX:         Ptr to X coordinate of last touch event
+/// \param[out] pnY:         Ptr to Y coordinate of last touch event
+/// \param[out] pnPress:     Ptr to Pressure level of last touch event (0 for none, 1 for touch)
+/// \param[out] peInputEvent Indication of event type
+/// \param[out] pnInputVal   Additional data for event type
+///
+/// \return true if an event was detected or false otherwise
+///
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal);
+
+
+// -----------------------------------------------------------------------
+// Dynamic Screen rotation and Touch axes swap/flip functions
+// -----------------------------------------------------------------------
+
+///
+/// Change rotation
+/// - Rotation 1 & 3 swap the width and height of the framebuffer.
+///   The framebuffer content is not preserved.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nRotation:   Screen Rotation value (0, 1, 2 or 3)
+///
+/// \return true if successful
+///
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation);
+
+
+// =======================================================================
+// Public APIs specific to this driver
+// - These functions are available to the application (eg. test
+//   harnesses) to inspect the rendered output and to inject input.
+// =======================================================================
+
+///
+/// Get a pointer to the framebuffer
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnStride:    Ptr to number of bytes per row (may be NULL)
+///
+/// \return Pointer to the pixel buffer or NULL if not allocated
+///
+uint8_t* gslc_DrvGetFrameBuf(gslc_tsGui* pGui,uint32_t* pnStride);
+
+///
+/// Read back the color of a pixel in the framebuffer
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of pixel
+/// \param[in]  nY:          Y coordinate of pixel
+///
+/// \return Color of the pixel (black if out of range). Note that
+///         in RGB565 mode the low-order color bits are lost.
+///
+gslc_tsColor gslc_DrvGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY);
+
+///
+/// Save the framebuffer to a binary PPM (P6) image file
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFname:      Path of the output file
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSaveFrame(gslc_tsGui* pGui,const char* pFname);
+
+///
+/// Queue a touch event to be returned by gslc_DrvGetTouch()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of touch
+/// \param[in]  nY:          Y coordinate of touch
+/// \param[in]  nPress:      Pressure (0 for release, >0 for touch)
+///
+/// \return true if queued, false if the queue is full
+///
+bool gslc_DrvInjectTouch(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nPress);
+
+///
+/// Get the drawing statistics accumulated since the last reset
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pStats:      Ptr to the statistics to fill
+///
+/// \return none
+///
+void gslc_DrvGetStats(gslc_tsGui* pGui,gslc_tsDrvStats* pStats);
+
+///
+/// Reset the drawing statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvResetStats(gslc_tsGui* pGui);
+
+///
+/// Flush changes in the framebuffer to a display panel on each page flip
+/// - On gslc_DrvPageFlipNow(), the framebuffer is compared against a
+///   shadow copy of what was last flushed, in tiles of DRV_MEMFB_TILE
+///   pixels square. Only the changed tiles are passed to pfuncFlush,
+///   with adjacent changed tiles coalesced into larger rectangles.
+/// - All drawing between page flips therefore happens in RAM, and the
+///   panel bus only carries the pixels that actually changed
+/// - The first flush (and the first after a rotation) covers the
+///   entire display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pfuncFlush:  Callback function (or NULL to disable)
+/// \param[in]  pShadowBuf:  Buffer for the shadow copy, the same size as
+///                          the framebuffer, or NULL to allocate one
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetFlushCb(gslc_tsGui* pGui,GSLC_CB_DRV_FLUSH pfuncFlush,uint8_t* pShadowBuf);
+
+
+// =======================================================================
+// Private Functions
+// - These functions are not included in the scope of APIs used by
+//   the core GUIslice library. Instead, these functions are used
+//   to support the operations within this driver layer.
+// =======================================================================
+
+///
+/// Translate a gslc_tsColor into the raw framebuffer format
+///
+/// \param[in]  nCol:        RGB value for conversion
+///
+/// \return A raw pixel value (RGB565 or 0x00RRGGBB)
+///
+uint32_t gslc_DrvAdaptColorRaw(gslc_tsColor nCol);
+
+///
+/// Fill a horizontal run of pixels in the framebuffer
+/// - No clipping is performed; the caller must ensure the run
+///   lies within the display
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[in]  nX:          X coordinate of first pixel
+/// \param[in]  nY:          Y coordinate of run
+/// \param[in]  nW:          Number of pixels
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvFillSpanRaw(gslc_tsDriver* pDriver,int16_t nX,int16_t nY,uint16_t nW,uint32_t nColRaw);
+
+///
+/// Fill a rectangle in the framebuffer, clipped to the clipping region
+/// - Unlike gslc_DrvDrawFillRect() this is not counted in the
+///   drawing statistics
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvFillRectRaw(gslc_tsDriver* pDriver,gslc_tsRect rRect,uint32_t nColRaw);
+
+///
+/// Set a pixel in the framebuffer if it lies within the clipping region
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[in]  nX:          X coordinate of pixel
+/// \param[in]  nY:          Y coordinate of pixel
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvDrawSetPixelRaw(gslc_tsDriver* pDriver,int16_t nX,int16_t nY,uint32_t nColRaw);
+
+///
+/// Draw a line in the framebuffer, clipped to the clipping region
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvDrawLineRaw(gslc_tsDriver* pDriver,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw);
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_DRV_MEMFB_H_
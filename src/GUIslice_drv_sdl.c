@@ -43,6 +43,8 @@
 #include "GUIslice_drv_sdl.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // ------------------------------------------------------------------------
 // Load display & touch drivers
@@ -95,16 +97,36 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   if (pGui->pvDriver) {
     gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 
+    pDriver->pSpriteSel  = NULL;
+
     #if defined(DRV_DISP_SDL1)
     pDriver->pSurfScreen = NULL;
+    pDriver->pSurfDisp   = NULL;
     pGui->bRedrawPartialEn = true;
     #endif
 
     #if defined(DRV_DISP_SDL2)
     pDriver->pWind       = NULL;
     pDriver->pRender     = NULL;
-    // In SDL2, always need full page redraw since backbuffer
-    // is treated as invalidated after every RenderPresent()
+    pDriver->pTexDisp    = NULL;
+    #if (DRV_HAS_READ_RECT)
+    pDriver->pTexRect    = NULL;
+    pDriver->nTexRectW   = 0;
+    pDriver->nTexRectH   = 0;
+    #endif
+    #if (DRV_SDL_TXT_CACHE_MAX > 0)
+    memset(pDriver->asTxtCache,0,sizeof(pDriver->asTxtCache));
+    pDriver->nTxtCacheMem   = 0;
+    pDriver->nTxtCacheTick  = 0;
+    pDriver->nTxtCacheHit   = 0;
+    pDriver->nTxtCacheMiss  = 0;
+    #endif
+    #if (DRV_SDL_TXT_ATLAS_EN)
+    memset(pDriver->apTxtAtlas,0,sizeof(pDriver->apTxtAtlas));
+    #endif
+    // In SDL2, need full page redraw since backbuffer is treated
+    // as invalidated after every RenderPresent(). This is changed
+    // below if a persistent render target is created.
     pGui->bRedrawPartialEn = false;
     #endif
   }
@@ -224,6 +246,28 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   // If we wanted to support scaling of the renderer, we would call
   // SDL_RenderSetLogicalSize() here. For now, don't scale.
 
+  #if (DRV_SDL_RENDER_TARGET)
+  // Direct all drawing to a texture that persists across page flips
+  // so that only the invalidated elements need to be redrawn
+  if (SDL_RenderTargetSupported(pDriver->pRender)) {
+    pDriver->pTexDisp = SDL_CreateTexture(pDriver->pRender,SDL_PIXELFORMAT_RGB888,
+      SDL_TEXTUREACCESS_TARGET,pGui->nDispW,pGui->nDispH);
+  }
+  if ((pDriver->pTexDisp != NULL) && (SDL_SetRenderTarget(pDriver->pRender,pDriver->pTexDisp) == 0)) {
+    SDL_SetTextureBlendMode(pDriver->pTexDisp,SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(pDriver->pRender,0x00,0x00,0x00,0xFF);
+    SDL_RenderClear(pDriver->pRender);
+    gslc_DrvSetClipRect(pGui,NULL);
+    pGui->bRedrawPartialEn = true;
+  } else {
+    GSLC_DEBUG_PRINT("NOTE: DrvInit() render target unavailable, using full redraw: %s\n",SDL_GetError());
+    if (pDriver->pTexDisp != NULL) {
+      SDL_DestroyTexture(pDriver->pTexDisp);
+      pDriver->pTexDisp = NULL;
+    }
+  }
+  #endif
+
 #endif
 
   // Initialize font engine
@@ -251,6 +295,18 @@ void gslc_DrvDestruct(gslc_tsGui* pGui)
 {
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // Cached textures belong to the renderer
+  gslc_DrvTxtCacheFlush(pGui);
+  #if (DRV_HAS_READ_RECT)
+  if (pDriver->pTexRect) {
+    SDL_DestroyTexture(pDriver->pTexRect);
+    pDriver->pTexRect = NULL;
+  }
+  #endif
+  if (pDriver->pTexDisp) {
+    SDL_DestroyTexture(pDriver->pTexDisp);
+    pDriver->pTexDisp = NULL;
+  }
   if (pDriver->pRender) {
     SDL_DestroyRenderer(pDriver->pRender);
     pDriver->pRender = NULL;
@@ -279,8 +335,75 @@ const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui)
 // Image/surface handling Functions
 // -----------------------------------------------------------------------
 
+// Decode a run-length encoded RGB565 image into a new surface
+// - Transparent runs are filled with the transparency color key
+// - FLASH is directly addressable on the SDL targets, so the same
+//   decoder is used for RAM and FLASH images
+static SDL_Surface* gslc_DrvDecodeRle16(const unsigned char* pBitmap)
+{
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  int16_t h = *(pImage++);
+  int16_t w = *(pImage++);
+
+  SDL_Surface* pSurf = NULL;
+  #if defined(DRV_DISP_SDL1)
+  pSurf = SDL_CreateRGBSurface(SDL_SWSURFACE,w,h,16,0xF800,0x07E0,0x001F,0);
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  // - In SDL2, the flags field is ignored, so set to 0
+  pSurf = SDL_CreateRGBSurface(0,w,h,16,0xF800,0x07E0,0x001F,0);
+  #endif
+  if (pSurf == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDecodeRle16() SDL_CreateRGBSurface failed: %s\n",SDL_GetError());
+    return NULL;
+  }
+
+  // Transparent runs take the color key
+  uint16_t nTransRaw = (uint16_t)SDL_MapRGB(pSurf->format,GSLC_BMP_TRANS_RGB);
+
+  if (SDL_MUSTLOCK(pSurf)) { SDL_LockSurface(pSurf); }
+  int16_t   nX = 0;
+  int16_t   nY = 0;
+  uint16_t  nRun,nCnt,nInd,nColRaw;
+  uint16_t* pRow = (uint16_t*)pSurf->pixels;
+  while (nY < h) {
+    nRun = *(pImage++);
+    nCnt = nRun & GSLC_RLE16_CNT_MASK;
+    if ((nCnt == 0) || (nX + nCnt > w)) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDecodeRle16() invalid run at row %d\n",nY);
+      break;
+    }
+    switch (nRun & GSLC_RLE16_OP_MASK) {
+      case GSLC_RLE16_OP_COPY:
+        for (nInd=0;nInd<nCnt;nInd++) { pRow[nX+nInd] = *(pImage++); }
+        break;
+      case GSLC_RLE16_OP_FILL:
+        nColRaw = *(pImage++);
+        for (nInd=0;nInd<nCnt;nInd++) { pRow[nX+nInd] = nColRaw; }
+        break;
+      default:
+        for (nInd=0;nInd<nCnt;nInd++) { pRow[nX+nInd] = nTransRaw; }
+        break;
+    }
+    // Runs do not cross rows
+    nX += nCnt;
+    if (nX == w) {
+      nX = 0;
+      nY++;
+      pRow = (uint16_t*)((uint8_t*)pRow + pSurf->pitch);
+    }
+  }
+  if (SDL_MUSTLOCK(pSurf)) { SDL_UnlockSurface(pSurf); }
+
+  return pSurf;
+}
+
 void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
 {
+  // Pointer to the surface image that was loaded
+  SDL_Surface* pSurfLoaded = NULL;
+  // Enable the transparency color key on the surface
+  bool bColorKey = GSLC_BMP_TRANS_EN;
 
   if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
     return NULL;
@@ -288,21 +411,25 @@ void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
     // Load image from SD card
     // TODO: Not yet supported
     return NULL;
-  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) {
-    // Load image from RAM
-    // TODO: Not yet supported
-    return NULL;
-  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG) {
-    // Load image from FLASH
-    // TODO: Not yet supported
-    return NULL;
+  } else if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) ||
+             ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG)) {
+    // Load image from RAM or FLASH
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Decode the runs once so that later redraws are a plain blit
+      pSurfLoaded = gslc_DrvDecodeRle16(sImgRef.pImgBuf);
+      if (pSurfLoaded == NULL) {
+        return NULL;
+      }
+      // Transparent runs always rely on the color key
+      bColorKey = true;
+    } else {
+      // TODO: Not yet supported
+      return NULL;
+    }
   } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
     // Load image from file system
     const char* pStrFname = sImgRef.pFname;
 
-    // Pointer to the surface image that was loaded
-    SDL_Surface* pSurfLoaded = NULL;
-
     // Load the image
     // - The SDL_LoadBMP() routine should be able to handle a multitude of
     //   BMP format types.
@@ -314,69 +441,66 @@ void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
       GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) failed: %s\n",pStrFname,SDL_GetError());
       return NULL;
     }
+  } else {
+    // If reached here, it is an error
+    return NULL;
+  } // eImgFlags
 
-    #if defined(DRV_DISP_SDL1)
+  #if defined(DRV_DISP_SDL1)
 
-    //Create an optimized surface
+  //Create an optimized surface
 
-    //The optimized surface that will be used
-    SDL_Surface* pSurfOptimized = SDL_DisplayFormat( pSurfLoaded );
+  //The optimized surface that will be used
+  SDL_Surface* pSurfOptimized = SDL_DisplayFormat( pSurfLoaded );
 
-    //Free the old surface
-    SDL_FreeSurface( pSurfLoaded );
+  //Free the old surface
+  SDL_FreeSurface( pSurfLoaded );
 
-    //If the surface was optimized
-    if( pSurfOptimized != NULL ) {
+  //If the surface was optimized
+  if( pSurfOptimized != NULL ) {
 
-      // Support optional transparency
-      if (GSLC_BMP_TRANS_EN) {
-        // Color key surface
-        // - Use transparency color key defined in BMP_TRANS_RGB
-        SDL_SetColorKey( pSurfOptimized, SDL_SRCCOLORKEY,
-          SDL_MapRGB( pSurfOptimized->format, GSLC_BMP_TRANS_RGB ) );
-      } // GSLC_BMP_TRANS_EN
-    }
+    // Support optional transparency
+    if (bColorKey) {
+      // Color key surface
+      // - Use transparency color key defined in BMP_TRANS_RGB
+      SDL_SetColorKey( pSurfOptimized, SDL_SRCCOLORKEY,
+        SDL_MapRGB( pSurfOptimized->format, GSLC_BMP_TRANS_RGB ) );
+    } // bColorKey
+  }
 
-    //Return the optimized surface
-    return (void*)(pSurfOptimized);
+  //Return the optimized surface
+  return (void*)(pSurfOptimized);
 
-    #endif
+  #endif
 
-    #if defined(DRV_DISP_SDL2)
-    gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
-    SDL_Texture*  pTex = NULL;
-
-    if( pSurfLoaded != NULL ) {
-
-      // Support optional transparency
-      if (GSLC_BMP_TRANS_EN) {
-        // Color key surface
-        // - Use transparency color key defined in BMP_TRANS_RGB
-        // - SDL2 passes SDL_TRUE instead of SDL_SRCCOLORKEY
-        SDL_SetColorKey( pSurfLoaded, SDL_TRUE,
-          SDL_MapRGB( pSurfLoaded->format, GSLC_BMP_TRANS_RGB ) );
-      } // GSLC_BMP_TRANS_EN
-    }
+  #if defined(DRV_DISP_SDL2)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Texture*  pTex = NULL;
 
-    pTex = (void*)SDL_CreateTextureFromSurface(pDriver->pRender,pSurfLoaded);
-    if (pTex == NULL) {
-      GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmp(%s) SDL_CreateTextureFromSurface() failed: %s\n",pStrFname,SDL_GetError());
-      return NULL;
-    }
+  // Support optional transparency
+  if (bColorKey) {
+    // Color key surface
+    // - Use transparency color key defined in BMP_TRANS_RGB
+    // - SDL2 passes SDL_TRUE instead of SDL_SRCCOLORKEY
+    SDL_SetColorKey( pSurfLoaded, SDL_TRUE,
+      SDL_MapRGB( pSurfLoaded->format, GSLC_BMP_TRANS_RGB ) );
+  } // bColorKey
 
-    // Dispose of surface
-    SDL_FreeSurface(pSurfLoaded);
-    pSurfLoaded = NULL;
+  pTex = (void*)SDL_CreateTextureFromSurface(pDriver->pRender,pSurfLoaded);
 
-    //Return the texture
-    return (void*)pTex;
+  // Dispose of surface
+  SDL_FreeSurface(pSurfLoaded);
+  pSurfLoaded = NULL;
 
-    #endif
+  if (pTex == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadImage() SDL_CreateTextureFromSurface() failed: %s\n",SDL_GetError());
+    return NULL;
+  }
 
-  } // eImgFlags
+  //Return the texture
+  return (void*)pTex;
 
-  // If reached here, it is an error
-  return NULL;
+  #endif
 }
 
 
@@ -505,6 +629,17 @@ void gslc_DrvImageDestruct(void* pvImg)
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // Record the region for gslc_GetClipRect()
+  if (pRect == NULL) {
+    // Default to the entire drawing target
+    pDriver->rClipRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+    if (pDriver->pSpriteSel != NULL) {
+      pDriver->rClipRect.w = pDriver->pSpriteSel->nW;
+      pDriver->rClipRect.h = pDriver->pSpriteSel->nH;
+    }
+  } else {
+    pDriver->rClipRect = *pRect;
+  }
 #if defined(DRV_DISP_SDL1)
   SDL_Surface*  pScreen = pDriver->pSurfScreen;
   if (pRect == NULL) {
@@ -557,6 +692,8 @@ void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
 {
   uint16_t  nFontInd;
   TTF_Font* pFont = NULL;
+  // Cached textures are keyed by font
+  gslc_DrvTxtCacheFlush(pGui);
   for (nFontInd=0;nFontInd<pGui->nFontCnt;nFontInd++) {
     if (pGui->asFont[nFontInd].pvFont != NULL) {
       pFont = (TTF_Font*)(pGui->asFont[nFontInd].pvFont);
@@ -568,6 +705,220 @@ void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
   TTF_Quit();
 }
 
+// -----------------------------------------------------------------------
+// Glyph atlas (SDL2)
+// -----------------------------------------------------------------------
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_ATLAS_EN)
+
+// Kerning between glyph pairs requires SDL_ttf 2.0.14 or later
+#if defined(SDL_TTF_COMPILEDVERSION) && (SDL_TTF_COMPILEDVERSION >= SDL_VERSIONNUM(2,0,14))
+  #define DRV_SDL_TTF_KERNING 1
+#else
+  #define DRV_SDL_TTF_KERNING 0
+#endif
+
+// Determine whether a string only contains characters in the atlas
+static bool gslc_DrvTxtAtlasSupports(const char* pStr)
+{
+  for (;*pStr;pStr++) {
+    uint8_t nCh = (uint8_t)(*pStr);
+    if ((nCh < DRV_SDL_TXT_ATLAS_CH_FIRST) || (nCh > DRV_SDL_TXT_ATLAS_CH_LAST)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Render the glyphs of a font into an atlas texture
+// - Glyphs are rendered in white so that the text color can
+//   be applied through the texture color modulation
+// - Returns false if the atlas could not be created
+static bool gslc_DrvTxtAtlasCreate(gslc_tsDriver* pDriver,gslc_tsDrvGlyphAtlas* pAtlas)
+{
+  TTF_Font*     pFont = pAtlas->pFont;
+  SDL_Surface*  apSurfGlyph[DRV_SDL_TXT_ATLAS_CH_NUM];
+  SDL_Color     colWhite = {255,255,255,255};
+  char          acCh[2] = {0,0};
+  uint16_t      nInd,nInd2;
+  int16_t       nX = 0;
+  int16_t       nY = 0;
+  bool          bOk = true;
+
+  // Render each glyph and fetch its metrics
+  pAtlas->nH = (int16_t)TTF_FontHeight(pFont);
+  for (nInd=0;nInd<DRV_SDL_TXT_ATLAS_CH_NUM;nInd++) {
+    uint16_t          nCh = DRV_SDL_TXT_ATLAS_CH_FIRST + nInd;
+    gslc_tsDrvGlyph*  pGlyph = &(pAtlas->asGlyph[nInd]);
+    int               nMinX,nMaxX,nMinY,nMaxY,nAdvance;
+    if (TTF_GlyphMetrics(pFont,nCh,&nMinX,&nMaxX,&nMinY,&nMaxY,&nAdvance) != 0) {
+      nMaxX = 0;
+      nAdvance = 0;
+    }
+    pGlyph->nAdvance  = (int16_t)nAdvance;
+    pGlyph->nMaxX     = (int16_t)nMaxX;
+    pGlyph->nW        = 0;
+    apSurfGlyph[nInd] = NULL;
+    if (nCh == ' ') {
+      // Nothing to draw
+      continue;
+    }
+    acCh[0] = (char)nCh;
+    apSurfGlyph[nInd] = TTF_RenderText_Blended(pFont,acCh,colWhite);
+    if ((apSurfGlyph[nInd] != NULL) && (apSurfGlyph[nInd]->h > pAtlas->nH)) {
+      pAtlas->nH = (int16_t)apSurfGlyph[nInd]->h;
+    }
+  }
+
+  // Assign the position of each glyph within the atlas
+  for (nInd=0;nInd<DRV_SDL_TXT_ATLAS_CH_NUM;nInd++) {
+    if (apSurfGlyph[nInd] == NULL) {
+      continue;
+    }
+    gslc_tsDrvGlyph* pGlyph = &(pAtlas->asGlyph[nInd]);
+    int16_t nW = (int16_t)apSurfGlyph[nInd]->w;
+    if (nW > DRV_SDL_TXT_ATLAS_W) {
+      nW = DRV_SDL_TXT_ATLAS_W;
+    }
+    if (nX + nW > DRV_SDL_TXT_ATLAS_W) {
+      nX = 0;
+      nY += pAtlas->nH;
+    }
+    pGlyph->nX  = nX;
+    pGlyph->nY  = nY;
+    pGlyph->nW  = nW;
+    nX += nW;
+  }
+
+  // Copy the glyphs into the atlas and convert it into a texture
+  SDL_Surface* pSurfAtlas = SDL_CreateRGBSurface(0,DRV_SDL_TXT_ATLAS_W,nY+pAtlas->nH,32,
+    0x00FF0000,0x0000FF00,0x000000FF,0xFF000000);
+  if (pSurfAtlas == NULL) {
+    bOk = false;
+  } else {
+    for (nInd=0;nInd<DRV_SDL_TXT_ATLAS_CH_NUM;nInd++) {
+      if (apSurfGlyph[nInd] == NULL) {
+        continue;
+      }
+      gslc_tsDrvGlyph* pGlyph = &(pAtlas->asGlyph[nInd]);
+      SDL_Rect rSrc = (SDL_Rect){0,0,pGlyph->nW,apSurfGlyph[nInd]->h};
+      SDL_Rect rDst = (SDL_Rect){pGlyph->nX,pGlyph->nY,pGlyph->nW,apSurfGlyph[nInd]->h};
+      // Copy the alpha channel rather than blending it
+      SDL_SetSurfaceBlendMode(apSurfGlyph[nInd],SDL_BLENDMODE_NONE);
+      SDL_BlitSurface(apSurfGlyph[nInd],&rSrc,pSurfAtlas,&rDst);
+    }
+    pAtlas->pTex = SDL_CreateTextureFromSurface(pDriver->pRender,pSurfAtlas);
+    if (pAtlas->pTex == NULL) {
+      bOk = false;
+    } else {
+      SDL_SetTextureBlendMode(pAtlas->pTex,SDL_BLENDMODE_BLEND);
+    }
+    SDL_FreeSurface(pSurfAtlas);
+  }
+  for (nInd=0;nInd<DRV_SDL_TXT_ATLAS_CH_NUM;nInd++) {
+    if (apSurfGlyph[nInd] != NULL) {
+      SDL_FreeSurface(apSurfGlyph[nInd]);
+    }
+  }
+
+  // Fetch the kerning between each pair of glyphs
+  memset(pAtlas->anKern,0,sizeof(pAtlas->anKern));
+  #if (DRV_SDL_TTF_KERNING)
+  if (TTF_GetFontKerning(pFont)) {
+    for (nInd=0;nInd<DRV_SDL_TXT_ATLAS_CH_NUM;nInd++) {
+      for (nInd2=0;nInd2<DRV_SDL_TXT_ATLAS_CH_NUM;nInd2++) {
+        pAtlas->anKern[nInd][nInd2] = (int8_t)TTF_GetFontKerningSizeGlyphs(pFont,
+          DRV_SDL_TXT_ATLAS_CH_FIRST+nInd,DRV_SDL_TXT_ATLAS_CH_FIRST+nInd2);
+      }
+    }
+  }
+  #else
+  (void)nInd2; // Unused
+  #endif
+
+  return bOk;
+}
+
+// Fetch the glyph atlas for a font, creating it on first use
+// - Returns NULL if no atlas is available for the font
+static gslc_tsDrvGlyphAtlas* gslc_DrvTxtAtlasGet(gslc_tsDriver* pDriver,TTF_Font* pFont)
+{
+  uint16_t nInd;
+  for (nInd=0;nInd<DRV_SDL_TXT_ATLAS_MAX;nInd++) {
+    gslc_tsDrvGlyphAtlas* pAtlas = pDriver->apTxtAtlas[nInd];
+    if (pAtlas == NULL) {
+      break;
+    }
+    if (pAtlas->pFont == pFont) {
+      // A failed atlas is retained so that creation isn't retried
+      return (pAtlas->pTex != NULL)? pAtlas : NULL;
+    }
+  }
+  if (nInd >= DRV_SDL_TXT_ATLAS_MAX) {
+    // No more atlases available
+    return NULL;
+  }
+
+  gslc_tsDrvGlyphAtlas* pAtlas = (gslc_tsDrvGlyphAtlas*)calloc(1,sizeof(gslc_tsDrvGlyphAtlas));
+  if (pAtlas == NULL) {
+    return NULL;
+  }
+  pAtlas->pFont = pFont;
+  pDriver->apTxtAtlas[nInd] = pAtlas;
+  if (!gslc_DrvTxtAtlasCreate(pDriver,pAtlas)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvTxtAtlasGet() failed to create glyph atlas: %s\n",SDL_GetError());
+    return NULL;
+  }
+  return pAtlas;
+}
+
+// Measure a string from the glyph atlas metrics
+static void gslc_DrvTxtAtlasSize(gslc_tsDrvGlyphAtlas* pAtlas,const char* pStr,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  int32_t nPenX = 0;
+  int32_t nExtentMax = 0;
+  int16_t nIndPrev = -1;
+  for (;*pStr;pStr++) {
+    int16_t           nInd = (uint8_t)(*pStr) - DRV_SDL_TXT_ATLAS_CH_FIRST;
+    gslc_tsDrvGlyph*  pGlyph = &(pAtlas->asGlyph[nInd]);
+    if (nIndPrev >= 0) {
+      nPenX += pAtlas->anKern[nIndPrev][nInd];
+    }
+    int32_t nExtent = nPenX + ((pGlyph->nMaxX > pGlyph->nAdvance)? pGlyph->nMaxX : pGlyph->nAdvance);
+    if (nExtent > nExtentMax) {
+      nExtentMax = nExtent;
+    }
+    nPenX += pGlyph->nAdvance;
+    nIndPrev = nInd;
+  }
+  *pnTxtSzW = (uint16_t)nExtentMax;
+  *pnTxtSzH = (uint16_t)pAtlas->nH;
+}
+
+// Draw a string by copying glyphs from the atlas
+static void gslc_DrvTxtAtlasDraw(gslc_tsDriver* pDriver,gslc_tsDrvGlyphAtlas* pAtlas,int16_t nTxtX,int16_t nTxtY,
+  const char* pStr,gslc_tsColor colTxt)
+{
+  int32_t nPenX = nTxtX;
+  int16_t nIndPrev = -1;
+  SDL_SetTextureColorMod(pAtlas->pTex,colTxt.r,colTxt.g,colTxt.b);
+  for (;*pStr;pStr++) {
+    int16_t           nInd = (uint8_t)(*pStr) - DRV_SDL_TXT_ATLAS_CH_FIRST;
+    gslc_tsDrvGlyph*  pGlyph = &(pAtlas->asGlyph[nInd]);
+    if (nIndPrev >= 0) {
+      nPenX += pAtlas->anKern[nIndPrev][nInd];
+    }
+    if (pGlyph->nW > 0) {
+      SDL_Rect rSrc = (SDL_Rect){pGlyph->nX,pGlyph->nY,pGlyph->nW,pAtlas->nH};
+      SDL_Rect rDst = (SDL_Rect){nPenX,nTxtY,pGlyph->nW,pAtlas->nH};
+      SDL_RenderCopy(pDriver->pRender,pAtlas->pTex,&rSrc,&rDst);
+    }
+    nPenX += pGlyph->nAdvance;
+    nIndPrev = nInd;
+  }
+}
+#endif // DRV_DISP_SDL2 && DRV_SDL_TXT_ATLAS_EN
+
 bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
         int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
 {
@@ -575,6 +926,19 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
   int32_t nTxtSzW,nTxtSzH;
   TTF_Font* pDrvFont = (TTF_Font*)(pFont->pvFont);
   if (!pDrvFont) { return false; }
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_ATLAS_EN)
+  // Measure from the glyph atlas if possible
+  if (gslc_DrvTxtAtlasSupports(pStr)) {
+    gslc_tsDrvGlyphAtlas* pAtlas = gslc_DrvTxtAtlasGet((gslc_tsDriver*)(pGui->pvDriver),pDrvFont);
+    if (pAtlas != NULL) {
+      gslc_DrvTxtAtlasSize(pAtlas,pStr,pnTxtSzW,pnTxtSzH);
+      *pnTxtX = 0;
+      *pnTxtY = 0;
+      return true;
+    }
+  }
+#endif
   if ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8) {
     TTF_SizeUTF8(pDrvFont,pStr,&nTxtSzW,&nTxtSzH);
   } else {
@@ -589,6 +953,152 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 }
 
 
+// -----------------------------------------------------------------------
+// Text texture cache (SDL2)
+// -----------------------------------------------------------------------
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+// Release the texture and string held by a cache entry
+static void gslc_DrvTxtCacheRelease(gslc_tsDriver* pDriver,gslc_tsDrvTxtCacheEntry* pEntry)
+{
+  if (pEntry->pTex != NULL) {
+    SDL_DestroyTexture(pEntry->pTex);
+    pDriver->nTxtCacheMem -= (uint32_t)pEntry->nW * pEntry->nH * 4;
+  }
+  free(pEntry->pStr);
+  pEntry->pTex  = NULL;
+  pEntry->pStr  = NULL;
+}
+
+// Hash a text string (FNV-1a)
+static uint32_t gslc_DrvTxtCacheHash(const char* pStr)
+{
+  uint32_t nHash = 2166136261u;
+  while (*pStr) {
+    nHash ^= (uint8_t)(*pStr++);
+    nHash *= 16777619u;
+  }
+  return nHash;
+}
+
+// Locate the cache entry for a text string
+// - Returns NULL if not cached
+static gslc_tsDrvTxtCacheEntry* gslc_DrvTxtCacheFind(gslc_tsDriver* pDriver,TTF_Font* pFont,const char* pStr,
+  uint32_t nHash,uint8_t eTxtEnc,gslc_tsColor colTxt)
+{
+  uint16_t nInd;
+  for (nInd=0;nInd<DRV_SDL_TXT_CACHE_MAX;nInd++) {
+    gslc_tsDrvTxtCacheEntry* pEntry = &(pDriver->asTxtCache[nInd]);
+    if ((pEntry->pTex == NULL) || (pEntry->nHash != nHash) || (pEntry->pFont != pFont)) {
+      continue;
+    }
+    if ((pEntry->eTxtEnc != eTxtEnc) || (!gslc_ColorEqual(pEntry->colTxt,colTxt))) {
+      continue;
+    }
+    if (strcmp(pEntry->pStr,pStr) == 0) {
+      return pEntry;
+    }
+  }
+  return NULL;
+}
+
+// Add a rendered text texture to the cache
+// - Discards the least recently used entries until the texture fits
+// - Returns false if the texture was not retained, in which case
+//   the caller remains responsible for destroying it
+static bool gslc_DrvTxtCacheAdd(gslc_tsDriver* pDriver,TTF_Font* pFont,const char* pStr,
+  uint32_t nHash,uint8_t eTxtEnc,gslc_tsColor colTxt,SDL_Texture* pTex,int16_t nW,int16_t nH)
+{
+  uint32_t nMem = (uint32_t)nW * nH * 4;
+  if (nMem > DRV_SDL_TXT_CACHE_MEM) {
+    return false;
+  }
+  char* pStrCopy = (char*)malloc(strlen(pStr)+1);
+  if (pStrCopy == NULL) {
+    return false;
+  }
+  strcpy(pStrCopy,pStr);
+
+  gslc_tsDrvTxtCacheEntry* pEntry = NULL;
+  while (true) {
+    // Select an unused entry, or else the least recently used one
+    gslc_tsDrvTxtCacheEntry* pEntryLru = NULL;
+    pEntry = NULL;
+    uint16_t nInd;
+    for (nInd=0;nInd<DRV_SDL_TXT_CACHE_MAX;nInd++) {
+      gslc_tsDrvTxtCacheEntry* pEntryCur = &(pDriver->asTxtCache[nInd]);
+      if (pEntryCur->pTex == NULL) {
+        if (pEntry == NULL) { pEntry = pEntryCur; }
+      } else if ((pEntryLru == NULL) || (pEntryCur->nLastUse < pEntryLru->nLastUse)) {
+        pEntryLru = pEntryCur;
+      }
+    }
+    if ((pEntry != NULL) && (pDriver->nTxtCacheMem + nMem <= DRV_SDL_TXT_CACHE_MEM)) {
+      break;
+    }
+    // Make room by discarding the least recently used entry
+    gslc_DrvTxtCacheRelease(pDriver,pEntryLru);
+  }
+
+  pEntry->pTex      = pTex;
+  pEntry->pFont     = pFont;
+  pEntry->pStr      = pStrCopy;
+  pEntry->nHash     = nHash;
+  pEntry->colTxt    = colTxt;
+  pEntry->eTxtEnc   = eTxtEnc;
+  pEntry->nW        = nW;
+  pEntry->nH        = nH;
+  pEntry->nLastUse  = ++pDriver->nTxtCacheTick;
+  pDriver->nTxtCacheMem += nMem;
+  return true;
+}
+#endif // DRV_DISP_SDL2 && DRV_SDL_TXT_CACHE_MAX
+
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui)
+{
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t nInd;
+  for (nInd=0;nInd<DRV_SDL_TXT_CACHE_MAX;nInd++) {
+    gslc_DrvTxtCacheRelease(pDriver,&(pDriver->asTxtCache[nInd]));
+  }
+  pDriver->nTxtCacheMem = 0;
+#endif
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_ATLAS_EN)
+  gslc_tsDriver* pDriverAtlas = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t nAtlasInd;
+  for (nAtlasInd=0;nAtlasInd<DRV_SDL_TXT_ATLAS_MAX;nAtlasInd++) {
+    gslc_tsDrvGlyphAtlas* pAtlas = pDriverAtlas->apTxtAtlas[nAtlasInd];
+    if (pAtlas != NULL) {
+      if (pAtlas->pTex != NULL) {
+        SDL_DestroyTexture(pAtlas->pTex);
+      }
+      free(pAtlas);
+      pDriverAtlas->apTxtAtlas[nAtlasInd] = NULL;
+    }
+  }
+#endif
+  (void)pGui; // Unused in some configurations
+}
+
+bool gslc_DrvGetTxtCacheStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss,uint32_t* pnMem)
+{
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  *pnHit  = pDriver->nTxtCacheHit;
+  *pnMiss = pDriver->nTxtCacheMiss;
+  *pnMem  = pDriver->nTxtCacheMem;
+  return true;
+#else
+  (void)pGui; // Unused
+  *pnHit  = 0;
+  *pnMiss = 0;
+  *pnMem  = 0;
+  return false;
+#endif
+}
+
+
 // NOTE: SDL driver is compiled as pure C, so can't use default parameters.
 //       Other drivers have specified colBg as a default, but so far no callers
 //       are depending on the default.
@@ -608,6 +1118,33 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   SDL_Surface*    pSurfTxt  = NULL;
   TTF_Font*       pDrvFont  = (TTF_Font*)(pFont->pvFont);
   if (!pDrvFont) { return false; }
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_ATLAS_EN)
+  // Compose the string from the glyph atlas if possible
+  if (gslc_DrvTxtAtlasSupports(pStr)) {
+    gslc_tsDrvGlyphAtlas* pAtlas = gslc_DrvTxtAtlasGet(pDriver,pDrvFont);
+    if (pAtlas != NULL) {
+      gslc_DrvTxtAtlasDraw(pDriver,pAtlas,nTxtX,nTxtY,pStr,colTxt);
+      return true;
+    }
+  }
+#endif
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+  // Reuse a previously rendered texture if available
+  uint8_t   eTxtEnc = (uint8_t)(eTxtFlags & GSLC_TXT_ENC);
+  uint32_t  nHash   = gslc_DrvTxtCacheHash(pStr);
+  gslc_tsDrvTxtCacheEntry* pEntry = gslc_DrvTxtCacheFind(pDriver,pDrvFont,pStr,nHash,eTxtEnc,colTxt);
+  if (pEntry != NULL) {
+    pDriver->nTxtCacheHit++;
+    pEntry->nLastUse = ++pDriver->nTxtCacheTick;
+    SDL_Rect rRectCache = (SDL_Rect){nTxtX,nTxtY,pEntry->nW,pEntry->nH};
+    SDL_RenderCopy(pDriver->pRender,pEntry->pTex,NULL,&rRectCache);
+    return true;
+  }
+  pDriver->nTxtCacheMiss++;
+#endif
+
   if ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8) {
     pSurfTxt = TTF_RenderUTF8_Blended(pDrvFont,pStr,gslc_DrvAdaptColor(colTxt));
   } else {
@@ -632,10 +1169,15 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   }
   SDL_RenderCopy(pRender,pTex,NULL,&rRect);
 
-  // Destroy texture
-  // TODO: Consider if worth optimizing by retaining texture in case
-  //       we need to redraw it without changing content
+  // Retain the texture in the cache for subsequent redraws,
+  // otherwise destroy it
+  #if (DRV_SDL_TXT_CACHE_MAX > 0)
+  if (!gslc_DrvTxtCacheAdd(pDriver,pDrvFont,pStr,nHash,eTxtEnc,colTxt,pTex,(int16_t)pSurfTxt->w,(int16_t)pSurfTxt->h)) {
+    SDL_DestroyTexture(pTex);
+  }
+  #else
   SDL_DestroyTexture(pTex);
+  #endif
   pTex = NULL;
 #endif
 
@@ -657,12 +1199,22 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 #if defined(DRV_DISP_SDL1)
-  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  SDL_Surface*   pScreen = (pDriver->pSpriteSel)? pDriver->pSurfDisp : pDriver->pSurfScreen;
   SDL_Flip(pScreen);
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Renderer* pRender = pDriver->pRender;
-  if (pRender) {
+  if ((pRender) && (pDriver->pTexDisp)) {
+    // Copy the persistent render target to the window and present it
+    // - The render target retains its contents, so drawing of the
+    //   next frame only needs to update the invalidated regions
+    // - Changing the target resets the clipping rect, so restore it
+    SDL_SetRenderTarget(pRender,NULL);
+    SDL_RenderCopy(pRender,pDriver->pTexDisp,NULL,NULL);
+    SDL_RenderPresent(pRender);
+    SDL_SetRenderTarget(pRender,(pDriver->pSpriteSel)? pDriver->pSpriteSel->pTex : pDriver->pTexDisp);
+    gslc_DrvSetClipRect(pGui,&pDriver->rClipRect);
+  } else if (pRender) {
     // Flip the offscreen buffer so we can display our drawing output
     SDL_RenderPresent(pRender);
     // Clear the drawing before any new drawing occurs
@@ -785,6 +1337,71 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
 #endif
 }
 
+bool gslc_DrvDrawLines(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+#if defined(DRV_DISP_SDL1)
+  // ERROR
+  return false;
+#endif
+#if defined(DRV_DISP_SDL2)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Renderer* pRender  = pDriver->pRender;
+  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+
+  // SDL_Point uses wider coordinates than gslc_tsPt, so the points
+  // are converted in batches. Each batch after the first starts
+  // from the last point of the previous one to keep the lines joined.
+  SDL_Point asPtSdl[32];
+  uint16_t  nIndPt  = 0;
+  uint16_t  nBatch  = 0;
+  while (nIndPt < nNumPt) {
+    asPtSdl[nBatch].x = asPt[nIndPt].x;
+    asPtSdl[nBatch].y = asPt[nIndPt].y;
+    nBatch++;
+    nIndPt++;
+    if ((nBatch == 32) || (nIndPt == nNumPt)) {
+      // Call SDL optimized routine
+      SDL_RenderDrawLines(pRender,asPtSdl,(int)nBatch);
+      asPtSdl[0] = asPtSdl[nBatch-1];
+      nBatch = 1;
+    }
+  }
+  return true;
+#endif
+}
+
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol)
+{
+#if defined(DRV_DISP_SDL1)
+  // ERROR
+  return false;
+#endif
+#if defined(DRV_DISP_SDL2)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Renderer* pRender  = pDriver->pRender;
+  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+
+  // Each span is a rect of height 1, converted in batches
+  SDL_Rect  arRectSdl[32];
+  uint16_t  nIndSpan = 0;
+  uint16_t  nBatch   = 0;
+  while (nIndSpan < nNumSpan) {
+    arRectSdl[nBatch].x = asSpan[nIndSpan].x0;
+    arRectSdl[nBatch].y = asSpan[nIndSpan].y;
+    arRectSdl[nBatch].w = asSpan[nIndSpan].x1 - asSpan[nIndSpan].x0 + 1;
+    arRectSdl[nBatch].h = 1;
+    nBatch++;
+    nIndSpan++;
+    if ((nBatch == 32) || (nIndSpan == nNumSpan)) {
+      // Call SDL optimized routine
+      SDL_RenderFillRects(pRender,arRectSdl,(int)nBatch);
+      nBatch = 0;
+    }
+  }
+  return true;
+#endif
+}
+
 bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
 {
   if (pGui == NULL) {
@@ -874,6 +1491,290 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
 }
 
 
+#if (DRV_HAS_READ_RECT)
+
+#if defined(DRV_DISP_SDL2)
+// Pixel format of the buffers used by gslc_DrvReadRect() / gslc_DrvWriteRect()
+#define DRV_SDL_RECT_FMT  SDL_PIXELFORMAT_RGB888
+#define DRV_SDL_RECT_BPP  4
+#endif
+
+uint32_t gslc_DrvReadRectLen(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return (uint32_t)rRect.w * rRect.h * pDriver->pSurfScreen->format->BytesPerPixel;
+#else
+  return (uint32_t)rRect.w * rRect.h * DRV_SDL_RECT_BPP;
+#endif
+}
+
+#if defined(DRV_DISP_SDL1)
+// Copy rows between the screen surface and a buffer
+// - bRead selects the direction (true: screen to buffer)
+static bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf,bool bRead)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+    (rRect.x + rRect.w > pScreen->w) || (rRect.y + rRect.h > pScreen->h)) {
+    return false;
+  }
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint8_t   nBpp    = pScreen->format->BytesPerPixel;
+  uint32_t  nRowLen = (uint32_t)rRect.w * nBpp;
+  uint8_t*  pRow    = (uint8_t*)pScreen->pixels + rRect.y * pScreen->pitch + rRect.x * nBpp;
+  for (uint16_t nRow = 0; nRow < rRect.h; nRow++) {
+    if (bRead) {
+      memcpy(pBuf,pRow,nRowLen);
+    } else {
+      memcpy(pRow,pBuf,nRowLen);
+    }
+    pBuf += nRowLen;
+    pRow += pScreen->pitch;
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+}
+
+#else // DRV_DISP_SDL2
+
+// Check that a region lies within the current render target
+// - The target is the selected sprite or else the persistent display
+//   texture. Without the latter, the contents of the back buffer are
+//   undefined so nothing can be read or restored.
+static bool gslc_DrvRectInTarget(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  int16_t nTargetW = pGui->nDispW;
+  int16_t nTargetH = pGui->nDispH;
+  if (pDriver->pSpriteSel) {
+    nTargetW = pDriver->pSpriteSel->nW;
+    nTargetH = pDriver->pSpriteSel->nH;
+  } else if (pDriver->pTexDisp == NULL) {
+    return false;
+  }
+  if ((rRect.x < 0) || (rRect.y < 0) || (rRect.w == 0) || (rRect.h == 0) ||
+    (rRect.x + rRect.w > nTargetW) || (rRect.y + rRect.h > nTargetH)) {
+    return false;
+  }
+  return true;
+}
+#endif // DRV_DISP_SDL1
+
+bool gslc_DrvReadRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf)
+{
+  if ((pGui == NULL) || (pBuf == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvReadRect(%s) with NULL ptr\n","");
+    return false;
+  }
+#if defined(DRV_DISP_SDL1)
+  return gslc_DrvCopyRect(pGui,rRect,pBuf,true);
+#else
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_DrvRectInTarget(pGui,rRect)) {
+    return false;
+  }
+  // Reads back from the current render target (display texture or sprite)
+  SDL_Rect rSRect = gslc_DrvAdaptRect(rRect);
+  if (SDL_RenderReadPixels(pDriver->pRender,&rSRect,DRV_SDL_RECT_FMT,pBuf,rRect.w * DRV_SDL_RECT_BPP) != 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvReadRect() SDL_RenderReadPixels failed: %s\n",SDL_GetError());
+    return false;
+  }
+  return true;
+#endif
+}
+
+bool gslc_DrvWriteRect(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf)
+{
+  if ((pGui == NULL) || (pBuf == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvWriteRect(%s) with NULL ptr\n","");
+    return false;
+  }
+#if defined(DRV_DISP_SDL1)
+  return gslc_DrvCopyRect(pGui,rRect,(uint8_t*)pBuf,false);
+#else
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Renderer*  pRender = pDriver->pRender;
+  if (!gslc_DrvRectInTarget(pGui,rRect)) {
+    return false;
+  }
+  // Upload through a streaming texture that is retained between calls
+  // and only reallocated when a larger region is requested
+  if ((pDriver->pTexRect == NULL) || (rRect.w > pDriver->nTexRectW) || (rRect.h > pDriver->nTexRectH)) {
+    uint16_t nTexW = (rRect.w > pDriver->nTexRectW)? rRect.w : pDriver->nTexRectW;
+    uint16_t nTexH = (rRect.h > pDriver->nTexRectH)? rRect.h : pDriver->nTexRectH;
+    if (pDriver->pTexRect) {
+      SDL_DestroyTexture(pDriver->pTexRect);
+    }
+    pDriver->pTexRect = SDL_CreateTexture(pRender,DRV_SDL_RECT_FMT,SDL_TEXTUREACCESS_STREAMING,nTexW,nTexH);
+    if (pDriver->pTexRect == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvWriteRect() SDL_CreateTexture failed: %s\n",SDL_GetError());
+      pDriver->nTexRectW = 0;
+      pDriver->nTexRectH = 0;
+      return false;
+    }
+    // Replace the destination pixels rather than blending with them
+    SDL_SetTextureBlendMode(pDriver->pTexRect,SDL_BLENDMODE_NONE);
+    pDriver->nTexRectW = nTexW;
+    pDriver->nTexRectH = nTexH;
+  }
+  SDL_Rect rSrc  = { 0, 0, rRect.w, rRect.h };
+  SDL_Rect rDest = gslc_DrvAdaptRect(rRect);
+  if (SDL_UpdateTexture(pDriver->pTexRect,&rSrc,pBuf,rRect.w * DRV_SDL_RECT_BPP) != 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvWriteRect() SDL_UpdateTexture failed: %s\n",SDL_GetError());
+    return false;
+  }
+  // The clipping region is not applied, so lift it for the copy
+  SDL_RenderSetClipRect(pRender,NULL);
+  SDL_RenderCopy(pRender,pDriver->pTexRect,&rSrc,&rDest);
+  gslc_DrvSetClipRect(pGui,&pDriver->rClipRect);
+  return true;
+#endif
+}
+#endif // DRV_HAS_READ_RECT
+
+
+// ------------------------------------------------------------------------
+// Sprite Functions
+// ------------------------------------------------------------------------
+
+bool gslc_DrvSpriteCreate(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,uint16_t nW,uint16_t nH)
+{
+  if ((pGui == NULL) || (pSprite == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pSprite->nW = nW;
+  pSprite->nH = nH;
+
+#if defined(DRV_DISP_SDL1)
+  // Match the format of the screen so that pushing the sprite is a plain copy
+  SDL_PixelFormat* pFmt = pDriver->pSurfScreen->format;
+  pSprite->pSurf = SDL_CreateRGBSurface(SDL_SWSURFACE,nW,nH,pFmt->BitsPerPixel,
+    pFmt->Rmask,pFmt->Gmask,pFmt->Bmask,pFmt->Amask);
+  if (pSprite->pSurf == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate() failed: %s\n",SDL_GetError());
+    return false;
+  }
+  SDL_FillRect(pSprite->pSurf,NULL,SDL_MapRGB(pSprite->pSurf->format,0,0,0));
+#endif
+
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer* pRender = pDriver->pRender;
+  pSprite->pTex = NULL;
+  if (!SDL_RenderTargetSupported(pRender)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate() renderer doesn't support render targets%s\n","");
+    return false;
+  }
+  pSprite->pTex = SDL_CreateTexture(pRender,SDL_PIXELFORMAT_RGBA8888,SDL_TEXTUREACCESS_TARGET,nW,nH);
+  if (pSprite->pTex == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate() failed: %s\n",SDL_GetError());
+    return false;
+  }
+  // Start from a defined state without disturbing the current target
+  // - Changing the target resets the clipping rect (empty if disabled)
+  SDL_Texture* pTexTarget = SDL_GetRenderTarget(pRender);
+  SDL_Rect     rClip;
+  SDL_RenderGetClipRect(pRender,&rClip);
+  SDL_SetRenderTarget(pRender,pSprite->pTex);
+  SDL_SetRenderDrawColor(pRender,0x00,0x00,0x00,0xFF);
+  SDL_RenderClear(pRender);
+  SDL_SetRenderTarget(pRender,pTexTarget);
+  SDL_RenderSetClipRect(pRender,(SDL_RectEmpty(&rClip))? NULL : &rClip);
+#endif
+
+  return true;
+}
+
+void gslc_DrvSpriteDestruct(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite)
+{
+  if ((pGui == NULL) || (pSprite == NULL)) {
+    return;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSpriteSel == pSprite) {
+    gslc_DrvSpriteSelect(pGui,NULL);
+  }
+#if defined(DRV_DISP_SDL1)
+  if (pSprite->pSurf) {
+    SDL_FreeSurface(pSprite->pSurf);
+    pSprite->pSurf = NULL;
+  }
+#endif
+#if defined(DRV_DISP_SDL2)
+  if (pSprite->pTex) {
+    SDL_DestroyTexture(pSprite->pTex);
+    pSprite->pTex = NULL;
+  }
+#endif
+}
+
+bool gslc_DrvSpriteSelect(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+#if defined(DRV_DISP_SDL1)
+  // All drawing is performed on pSurfScreen, so it is
+  // swapped with the sprite surface while selected
+  if ((pSprite != NULL) && (pSprite->pSurf == NULL)) {
+    return false;
+  }
+  if (pDriver->pSpriteSel == NULL) {
+    pDriver->pSurfDisp = pDriver->pSurfScreen;
+  }
+  pDriver->pSurfScreen = (pSprite)? pSprite->pSurf : pDriver->pSurfDisp;
+#endif
+
+#if defined(DRV_DISP_SDL2)
+  if ((pSprite != NULL) && (pSprite->pTex == NULL)) {
+    return false;
+  }
+  // Deselecting a sprite returns to the persistent render target (if any)
+  if (SDL_SetRenderTarget(pDriver->pRender,(pSprite)? pSprite->pTex : pDriver->pTexDisp) != 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteSelect() failed: %s\n",SDL_GetError());
+    return false;
+  }
+#endif
+
+  pDriver->pSpriteSel = pSprite;
+  gslc_DrvSetClipRect(pGui,NULL);
+  return true;
+}
+
+bool gslc_DrvSpritePush(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,int16_t nDstX,int16_t nDstY)
+{
+  if ((pGui == NULL) || (pSprite == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpritePush(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSpriteSel != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpritePush() called while a sprite is selected%s\n","");
+    return false;
+  }
+  SDL_Rect rDst = gslc_DrvAdaptRect((gslc_tsRect) { nDstX, nDstY, pSprite->nW, pSprite->nH });
+
+#if defined(DRV_DISP_SDL1)
+  // The blit is limited by the clipping rect of the screen
+  if ((pSprite->pSurf == NULL) || (SDL_BlitSurface(pSprite->pSurf,NULL,pDriver->pSurfScreen,&rDst) != 0)) {
+    return false;
+  }
+#endif
+
+#if defined(DRV_DISP_SDL2)
+  if ((pSprite->pTex == NULL) || (SDL_RenderCopy(pDriver->pRender,pSprite->pTex,NULL,&rDst) != 0)) {
+    return false;
+  }
+#endif
+
+  return true;
+}
+
+
 
 // ------------------------------------------------------------------------
 // Touch Functions (via SDL)
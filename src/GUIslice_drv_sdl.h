@@ -76,6 +76,8 @@ extern "C" {
 #if defined(DRV_DISP_SDL1)
   #define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
   #define DRV_HAS_DRAW_LINE              0 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_LINES             0 ///< Support gslc_DrvDrawLines()
+  #define DRV_HAS_DRAW_SPANS             0 ///< Support gslc_DrvDrawSpans()
   #define DRV_HAS_DRAW_RECT_FRAME        0 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
   #define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
@@ -91,6 +93,8 @@ extern "C" {
 #if defined(DRV_DISP_SDL2)
   #define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
   #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_LINES             1 ///< Support gslc_DrvDrawLines()
+  #define DRV_HAS_DRAW_SPANS             1 ///< Support gslc_DrvDrawSpans()
   #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
   #define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
@@ -103,20 +107,155 @@ extern "C" {
   #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
 #endif
 
+// =======================================================================
+// Persistent render target (SDL2 only)
+// - When enabled, all drawing to the display is directed to a target
+//   texture that retains its contents across frames. Each page flip
+//   copies the texture to the window before presenting it.
+// - This allows partial redraw (only invalidated elements are drawn
+//   each frame) since the contents of the renderer's back buffer are
+//   undefined after SDL_RenderPresent().
+// - If the renderer doesn't support render targets, the driver falls
+//   back to redrawing the full page on every update
+// =======================================================================
+#if defined(DRV_DISP_SDL2)
+  #if !defined(DRV_SDL_RENDER_TARGET)
+    #define DRV_SDL_RENDER_TARGET       1         ///< Enable persistent render target
+  #endif
+#endif
+
 #define DRV_OVERRIDE_TXT_ALIGN      0 ///< Driver provides text alignment
+#define DRV_HAS_REDRAW_BATCH        0 ///< Support gslc_DrvRedrawBegin() / gslc_DrvRedrawEnd()
+// - SDL2 reads and writes the persistent render target, so support
+//   depends on DRV_SDL_RENDER_TARGET
+#if defined(DRV_DISP_SDL1)
+  #define DRV_HAS_READ_RECT         1 ///< Support gslc_DrvReadRect() / gslc_DrvWriteRect()
+#else
+  #define DRV_HAS_READ_RECT         (DRV_SDL_RENDER_TARGET) ///< Support gslc_DrvReadRect() / gslc_DrvWriteRect()
+#endif
+#define DRV_HAS_SPRITE              1 ///< Support gslc_DrvSpriteCreate() and off-screen drawing
+
+// =======================================================================
+// Text texture cache (SDL2 only)
+// - Rendered text strings are retained as textures so that redrawing
+//   an unchanged string only requires a texture copy
+// - Entries are keyed by font, string, color and encoding and the
+//   least recently used entries are discarded once either limit is
+//   reached
+// - Set DRV_SDL_TXT_CACHE_MAX to 0 to disable the cache
+// =======================================================================
+#if defined(DRV_DISP_SDL2)
+  #if !defined(DRV_SDL_TXT_CACHE_MAX)
+    #define DRV_SDL_TXT_CACHE_MAX       64        ///< Maximum number of cached text textures
+  #endif
+  #if !defined(DRV_SDL_TXT_CACHE_MEM)
+    #define DRV_SDL_TXT_CACHE_MEM       (2*1024*1024) ///< Maximum texture memory (bytes) used by the cache
+  #endif
+#endif
+
+// =======================================================================
+// Glyph atlas text rendering (SDL2 only)
+// - When enabled, the printable ASCII glyphs of each font are rendered
+//   once into a texture along with their advance and kerning metrics.
+//   Strings consisting of these characters are then drawn by copying
+//   glyphs from the atlas and measured without calling SDL_ttf.
+// - This suits text that changes constantly (eg. numeric readouts),
+//   which would not benefit from the text texture cache.
+// - Other strings continue to be rendered by SDL_ttf
+// =======================================================================
+#if defined(DRV_DISP_SDL2)
+  #if !defined(DRV_SDL_TXT_ATLAS_EN)
+    #define DRV_SDL_TXT_ATLAS_EN        0         ///< Enable glyph atlas text rendering
+  #endif
+  #if !defined(DRV_SDL_TXT_ATLAS_MAX)
+    #define DRV_SDL_TXT_ATLAS_MAX       4         ///< Maximum number of fonts with a glyph atlas
+  #endif
+  #define DRV_SDL_TXT_ATLAS_CH_FIRST    32        ///< First character in atlas
+  #define DRV_SDL_TXT_ATLAS_CH_LAST     126       ///< Last character in atlas
+  #define DRV_SDL_TXT_ATLAS_CH_NUM      (DRV_SDL_TXT_ATLAS_CH_LAST-DRV_SDL_TXT_ATLAS_CH_FIRST+1)
+  #define DRV_SDL_TXT_ATLAS_W           512       ///< Width of atlas texture
+#endif
 
 // =======================================================================
 // Driver-specific members
 // =======================================================================
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+/// Text texture cache entry
 typedef struct {
+  SDL_Texture*        pTex;             ///< Rendered text texture (NULL if entry unused)
+  TTF_Font*           pFont;            ///< Font used to render the text
+  char*               pStr;             ///< Copy of the text string
+  uint32_t            nHash;            ///< Hash of the text string
+  gslc_tsColor        colTxt;           ///< Text color
+  uint8_t             eTxtEnc;          ///< Text encoding (GSLC_TXT_ENC_*)
+  int16_t             nW;               ///< Texture width
+  int16_t             nH;               ///< Texture height
+  uint32_t            nLastUse;         ///< Value of nTxtCacheTick when last drawn
+} gslc_tsDrvTxtCacheEntry;
+#endif
 
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_ATLAS_EN)
+/// Glyph within a glyph atlas
+typedef struct {
+  int16_t             nX;               ///< X offset of glyph within atlas
+  int16_t             nY;               ///< Y offset of glyph within atlas
+  int16_t             nW;               ///< Width of glyph image
+  int16_t             nAdvance;         ///< Horizontal advance to next glyph
+  int16_t             nMaxX;            ///< Rightmost extent of glyph (relative to pen)
+} gslc_tsDrvGlyph;
+
+/// Glyph atlas for a font
+typedef struct {
+  TTF_Font*           pFont;            ///< Font rendered in the atlas
+  SDL_Texture*        pTex;             ///< Atlas texture (NULL if atlas could not be created)
+  int16_t             nH;               ///< Height of each glyph image (font height)
+  gslc_tsDrvGlyph     asGlyph[DRV_SDL_TXT_ATLAS_CH_NUM]; ///< Glyph positions and metrics
+  int8_t              anKern[DRV_SDL_TXT_ATLAS_CH_NUM][DRV_SDL_TXT_ATLAS_CH_NUM]; ///< Kerning between glyph pairs
+} gslc_tsDrvGlyphAtlas;
+#endif
+
+/// Off-screen drawing surface (sprite)
+typedef struct {
+  uint16_t            nW;               ///< Width of the sprite
+  uint16_t            nH;               ///< Height of the sprite
   #if defined(DRV_DISP_SDL1)
-  SDL_Surface*        pSurfScreen;      ///< Surface ptr for screen
+  SDL_Surface*        pSurf;            ///< Sprite surface (NULL if not created)
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  SDL_Texture*        pTex;             ///< Sprite render target (NULL if not created)
+  #endif
+} gslc_tsDrvSprite;
+
+typedef struct {
+
+  #if defined(DRV_DISP_SDL1)
+  SDL_Surface*        pSurfScreen;      ///< Surface ptr for drawing (screen or selected sprite)
+  SDL_Surface*        pSurfDisp;        ///< Surface ptr for screen while a sprite is selected
   #endif
 
   #if defined(DRV_DISP_SDL2)
   SDL_Window*         pWind;            ///< SDL2 Window
   SDL_Renderer*       pRender;          ///< SDL2 Rendering engine
+  SDL_Texture*        pTexDisp;         ///< Persistent render target for the display (NULL if not used)
+  #endif
+
+  #if defined(DRV_DISP_SDL2) && (DRV_HAS_READ_RECT)
+  SDL_Texture*        pTexRect;         ///< Streaming texture used by gslc_DrvWriteRect() (NULL until used)
+  uint16_t            nTexRectW;        ///< Width of pTexRect
+  uint16_t            nTexRectH;        ///< Height of pTexRect
+  #endif
+
+  #if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+  gslc_tsDrvTxtCacheEntry asTxtCache[DRV_SDL_TXT_CACHE_MAX]; ///< Text texture cache
+  uint32_t            nTxtCacheMem;     ///< Texture memory (bytes) held by the cache
+  uint32_t            nTxtCacheTick;    ///< Counter used to order cache entries by use
+  uint32_t            nTxtCacheHit;     ///< Number of text draws served from the cache
+  uint32_t            nTxtCacheMiss;    ///< Number of text draws that required rendering
+  #endif
+
+  #if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_ATLAS_EN)
+  gslc_tsDrvGlyphAtlas* apTxtAtlas[DRV_SDL_TXT_ATLAS_MAX]; ///< Glyph atlases (allocated on first use of font)
   #endif
 
   #if defined(DRV_TOUCH_TSLIB)
@@ -125,6 +264,8 @@ typedef struct {
 
   gslc_tsRect         rClipRect;        ///< Clipping rectangle
 
+  gslc_tsDrvSprite*   pSpriteSel;       ///< Sprite that drawing is directed to (NULL for the display)
+
 } gslc_tsDriver;
 
 
@@ -363,6 +504,33 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
 
 
+///
+/// Discard all textures in the text cache and any glyph atlases
+/// - Only applicable to SDL2 with DRV_SDL_TXT_CACHE_MAX > 0
+///   or DRV_SDL_TXT_ATLAS_EN
+/// - Called automatically when fonts or the renderer are destroyed
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui);
+
+
+///
+/// Fetch the text cache statistics
+/// - Only applicable to SDL2 with DRV_SDL_TXT_CACHE_MAX > 0
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnHit:       Ptr to number of text draws served from the cache
+/// \param[out] pnMiss:      Ptr to number of text draws that required rendering
+/// \param[out] pnMem:       Ptr to texture memory (bytes) held by the cache
+///
+/// \return true if success, false if the cache is not enabled
+///
+bool gslc_DrvGetTxtCacheStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss,uint32_t* pnMem);
+
+
 // -----------------------------------------------------------------------
 // Screen Management Functions
 // -----------------------------------------------------------------------
@@ -444,6 +612,30 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 ///
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
+///
+/// Draw a series of connected lines
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to connect
+/// \param[in]  nNumPt:      Number of points in array (at least 2)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLines(gslc_tsGui* pGui,const gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Fill a series of horizontal spans
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans (x0 <= x1, inclusive)
+/// \param[in]  nNumSpan:    Number of spans in array
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nNumSpan,gslc_tsColor nCol);
+
 
 // TODO: Add DrvDrawFrameCircle()
 // TODO: Add DrvDrawFillCircle()
@@ -478,6 +670,111 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
 void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
 
 
+#if (DRV_HAS_READ_RECT)
+
+///
+/// Get the buffer size required by gslc_DrvReadRect() for a region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display
+///
+/// \return Number of bytes required
+///
+uint32_t gslc_DrvReadRectLen(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
+///
+/// Copy a region of the display into a buffer
+/// - The pixels are stored row by row in the driver's native format
+///   (SDL2: 32-bit RGB888 from the current render target, so the
+///   alpha channel of a selected sprite is not retained)
+/// - Reads from the sprite selected by gslc_DrvSpriteSelect() if any
+/// - The region must lie within the display (or the selected sprite)
+/// - SDL2 requires the persistent render target (DRV_SDL_RENDER_TARGET)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display to read
+/// \param[out] pBuf:        Buffer of at least gslc_DrvReadRectLen() bytes
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvReadRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf);
+
+
+///
+/// Write a buffer captured by gslc_DrvReadRect() back to the display
+/// - Writes to the sprite selected by gslc_DrvSpriteSelect() if any
+/// - The clipping region is not applied
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display to write
+/// \param[in]  pBuf:        Buffer from gslc_DrvReadRect() for the same region
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvWriteRect(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf);
+
+#endif // DRV_HAS_READ_RECT
+
+
+// -----------------------------------------------------------------------
+// Sprite Functions
+// -----------------------------------------------------------------------
+
+///
+/// Create an off-screen drawing surface (sprite)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pSprite:     Pointer to sprite to initialize
+/// \param[in]  nW:          Width of the sprite
+/// \param[in]  nH:          Height of the sprite
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpriteCreate(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,uint16_t nW,uint16_t nH);
+
+
+///
+/// Release the resources associated with a sprite
+/// - If the sprite is selected, drawing reverts to the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite
+///
+/// \return none
+///
+void gslc_DrvSpriteDestruct(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite);
+
+
+///
+/// Direct all subsequent drawing to a sprite or back to the display
+/// - While a sprite is selected, drawing coordinates are relative
+///   to the top-left corner of the sprite
+/// - The clipping region is reset to the whole of the new target
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite (or NULL for the display)
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpriteSelect(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite);
+
+
+///
+/// Copy the contents of a sprite to the display
+/// - The display must be the current drawing target
+/// - The copy is limited by the clipping region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite
+/// \param[in]  nDstX:       X coordinate of the top-left corner on the display
+/// \param[in]  nDstY:       Y coordinate of the top-left corner on the display
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpritePush(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,int16_t nDstX,int16_t nDstY);
+
+
 // -----------------------------------------------------------------------
 // Touch Functions
 // -----------------------------------------------------------------------
@@ -113,6 +113,17 @@ TFT_eSPI m_disp = TFT_eSPI();
   TFT_eFEX fex = TFT_eFEX(&m_disp);
 #endif
 
+// Indicates that gslc_DrvRedrawBegin() has opened a bus transaction
+// - While it is open, TFT_eSPI keeps the display selected across all
+//   of its drawing APIs
+static bool m_bRedrawWrite = false;
+
+// Sprite selected by gslc_DrvSpriteSelect() (NULL for the display)
+static TFT_eSprite* m_pSprite = NULL;
+
+// Direct a drawing call to the selected sprite or else the display
+#define DRV_DRAW(call) ((m_pSprite != NULL)? m_pSprite->call : m_disp.call)
+
 // ------------------------------------------------------------------------
 #if defined(DRV_TOUCH_ADA_STMPE610)
   #if (ADATOUCH_I2C_HW) // Use I2C
@@ -206,6 +217,8 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
 
     pDriver->pvFontLast = NULL;
 
+    pDriver->pSpriteSel = NULL;
+
     // These displays can accept partial redraw as they retain the last
     // image in the controller graphics RAM
     pGui->bRedrawPartialEn = true;
@@ -342,7 +355,10 @@ bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
   // driver struct, but the drawing code does not currently
   // use it.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
-  if (pRect == NULL) {
+  if ((pRect == NULL) && (pDriver->pSpriteSel != NULL)) {
+    // Default to entire sprite
+    pDriver->rClipRect = {0,0,pDriver->pSpriteSel->nW,pDriver->pSpriteSel->nH};
+  } else if (pRect == NULL) {
     // Default to entire display
     pDriver->rClipRect = {0,0,pGui->nDispW,pGui->nDispH};
   } else {
@@ -356,7 +372,7 @@ bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
   // The setViewport() API is only available in recent versions of
   // TFT_eSPI (v2.3.2+).
   #if (TFT_ESPI_FEATURES & 0x0001) // Bit 0 = Viewport capability
-    m_disp.setViewport(pDriver->rClipRect.x,pDriver->rClipRect.y,pDriver->rClipRect.w,pDriver->rClipRect.h,false);
+    DRV_DRAW(setViewport(pDriver->rClipRect.x,pDriver->rClipRect.y,pDriver->rClipRect.w,pDriver->rClipRect.h,false));
   #endif
 
   return true;
@@ -423,32 +439,32 @@ bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,i
   uint16_t nTxtScale = pFont->nSize;
 
   #ifdef SMOOTH_FONT
-    m_disp.setTextColor(nColRaw,nColBgRaw);
+    DRV_DRAW(setTextColor(nColRaw,nColBgRaw));
   #else
-    m_disp.setTextColor(nColRaw);
+    DRV_DRAW(setTextColor(nColRaw));
   #endif
 
   // TFT_eSPI font API differs from Adafruit-GFX's setFont() API
   if (pFont->pvFont == NULL) {
-    m_disp.setTextFont(1);
+    DRV_DRAW(setTextFont(1));
   } else {
     #ifdef SMOOTH_FONT
       if (pFont->eFontRefType  == GSLC_FONTREF_FNAME){
         if (pFont->pvFont != pDriver->pvFontLast) {
-          m_disp.loadFont((const char*)pFont->pvFont);
+          DRV_DRAW(loadFont((const char*)pFont->pvFont));
           pDriver->pvFontLast = pFont->pvFont;
         }
       } else if ((pFont->eFontRefType  == GSLC_FONTREF_PTR) &&
                   (pFont->eFontRefMode == GSLC_FONTREF_MODE_1)){
-          m_disp.loadFont((const uint8_t *)pFont->pvFont);
+          DRV_DRAW(loadFont((const uint8_t *)pFont->pvFont));
       } else {
-        m_disp.setFreeFont((const GFXfont *)pFont->pvFont);
+        DRV_DRAW(setFreeFont((const GFXfont *)pFont->pvFont));
       }
     #else
-      m_disp.setFreeFont((const GFXfont *)pFont->pvFont);
+      DRV_DRAW(setFreeFont((const GFXfont *)pFont->pvFont));
     #endif
   }
-  m_disp.setTextSize(nTxtScale);
+  DRV_DRAW(setTextSize(nTxtScale));
 
   // Default to mid-mid datum
   int8_t  nDatum = MC_DATUM;
@@ -468,9 +484,9 @@ bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,i
     case GSLC_ALIGN_BOT_RIGHT:  nDatum = BR_DATUM; nTxtX = nX1; nTxtY = nY1; break;
     default:                    nDatum = MC_DATUM; break;
   }
-  m_disp.setTextDatum(nDatum);
+  DRV_DRAW(setTextDatum(nDatum));
 
-  m_disp.drawString(pStr,nTxtX,nTxtY);
+  DRV_DRAW(drawString(pStr,nTxtX,nTxtY));
 
   // For now, always return true
   return true;
@@ -498,35 +514,35 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   #ifdef SMOOTH_FONT
       if (pFont->eFontRefType  == GSLC_FONTREF_FNAME){
         if (pFont->pvFont != pDriver->pvFontLast) {
-          m_disp.loadFont((const char*)pFont->pvFont);
+          DRV_DRAW(loadFont((const char*)pFont->pvFont));
           pDriver->pvFontLast = pFont->pvFont;
         }
-        m_disp.setTextColor(nColRaw,nColBgRaw);
+        DRV_DRAW(setTextColor(nColRaw,nColBgRaw));
       } else {
-        m_disp.setTextColor(nColRaw);
+        DRV_DRAW(setTextColor(nColRaw));
       }
   #else
-  m_disp.setTextColor(nColRaw);
+  DRV_DRAW(setTextColor(nColRaw));
   #endif
   // m_disp.setCursor(nTxtX,nTxtY);
-  m_disp.setTextSize(nTxtScale);
+  DRV_DRAW(setTextSize(nTxtScale));
 
   // Default to top-left datum
-  m_disp.setTextDatum(TL_DATUM);
+  DRV_DRAW(setTextDatum(TL_DATUM));
 
   if ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_RAM) {
     // String in SRAM; can access buffer directly
     // m_disp.println(pStr);
-    m_disp.drawString(pStr,nTxtX,nTxtY);
+    DRV_DRAW(drawString(pStr,nTxtX,nTxtY));
   } else if ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG) {
     // String in PROGMEM (flash); must access via pgm_* calls
     char    ch;
     int     nXOffset = 0;
     while ((ch = pgm_read_byte(pStr++))) {
       // m_disp.print(ch);
-      nXOffset += m_disp.drawChar(ch,nTxtX+nXOffset,nTxtY);
+      nXOffset += DRV_DRAW(drawChar(ch,nTxtX+nXOffset,nTxtY));
     }
-    m_disp.println();
+    DRV_DRAW(println());
   }
 
   return true;
@@ -536,6 +552,25 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 // Screen Management Functions
 // -----------------------------------------------------------------------
 
+void gslc_DrvRedrawBegin(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  // Keep the display selected for the entire redraw
+  if (!m_bRedrawWrite) {
+    m_disp.startWrite();
+    m_bRedrawWrite = true;
+  }
+}
+
+void gslc_DrvRedrawEnd(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  if (m_bRedrawWrite) {
+    m_disp.endWrite();
+    m_bRedrawWrite = false;
+  }
+}
+
 void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 {
   #if defined(DRV_DISP_ADAGFX_ILI9341) || defined(DRV_DISP_ADAGFX_ILI9341_8BIT) || \
@@ -561,12 +596,12 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 
 inline void gslc_DrvDrawPoint_base(int16_t nX, int16_t nY, uint16_t nColRaw)
 {
-  m_disp.drawPixel(nX,nY,nColRaw);
+  DRV_DRAW(drawPixel(nX,nY,nColRaw));
 }
 
 inline void gslc_DrvDrawLine_base(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint16_t nColRaw)
 {
-  m_disp.drawLine(nX0,nY0,nX1,nY1,nColRaw);
+  DRV_DRAW(drawLine(nX0,nY0,nX1,nY1,nColRaw));
 }
 
 
@@ -598,7 +633,7 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+  DRV_DRAW(fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw));
   return true;
 }
 
@@ -608,7 +643,7 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
   // TODO: Support GSLC_CLIP_EN
   // - Would need to determine how to clip the rounded corners
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  DRV_DRAW(fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw));
 #endif
   return true;
 }
@@ -647,7 +682,7 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   nY1 = rRect.y + rRect.h - 1;
   if (gslc_ClipLine(&pDriver->rClipRect, &nX0, &nY0, &nX1, &nY1)) { gslc_DrvDrawLine_base(nX0, nY0, nX1, nY1, nColRaw); }
 #else
-  m_disp.drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+  DRV_DRAW(drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw));
 #endif
   return true;
 }
@@ -659,7 +694,7 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 
   // TODO: Support GSLC_CLIP_EN
   // - Would need to determine how to clip the rounded corners
-  m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  DRV_DRAW(drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw));
 #endif
   return true;
 }
@@ -686,7 +721,7 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nR
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.drawCircle(nMidX,nMidY,nRadius,nColRaw);
+  DRV_DRAW(drawCircle(nMidX,nMidY,nRadius,nColRaw));
 #endif
   return true;
 }
@@ -699,7 +734,7 @@ bool gslc_DrvDrawFillCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRa
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillCircle(nMidX,nMidY,nRadius,nColRaw);
+  DRV_DRAW(fillCircle(nMidX,nMidY,nRadius,nColRaw));
 #endif
   return true;
 }
@@ -715,7 +750,7 @@ bool gslc_DrvDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  DRV_DRAW(drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw));
 #endif
   return true;
 }
@@ -730,7 +765,7 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  DRV_DRAW(fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw));
 #endif
   return true;
 }
@@ -794,6 +829,46 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
 }
 // ----- REFERENCE CODE end
 
+// Push an RGB565 image to the drawing target, skipping transparent pixels
+// - TFT_eSprite doesn't provide the transparent variant of pushImage(),
+//   so into a sprite the runs of opaque pixels are pushed individually
+static void gslc_DrvPushImageTrans(int16_t nDstX,int16_t nDstY,int16_t nW,int16_t nH,
+  const uint16_t* pImage,bool bProgMem,uint16_t nTransRaw)
+{
+  if (m_pSprite == NULL) {
+    if (bProgMem) {
+      m_disp.pushImage(nDstX, nDstY, nW, nH, pImage, nTransRaw);
+    } else {
+      m_disp.pushImage(nDstX, nDstY, nW, nH, (uint16_t*)pImage, nTransRaw);
+    }
+    return;
+  }
+  // The image data is compared before any byte swapping
+  if (m_pSprite->getSwapBytes()) {
+    nTransRaw = (nTransRaw >> 8) | (nTransRaw << 8);
+  }
+  int16_t  nX,nX0;
+  uint16_t nColRaw;
+  for (int16_t nY=0; nY<nH; nY++) {
+    nX0 = 0;
+    for (nX=0; nX<=nW; nX++) {
+      if (nX < nW) {
+        nColRaw = (bProgMem)? pgm_read_word(pImage+nX) : pImage[nX];
+        if (nColRaw != nTransRaw) { continue; }
+      }
+      if (nX > nX0) {
+        if (bProgMem) {
+          m_pSprite->pushImage(nDstX+nX0, nDstY+nY, nX-nX0, 1, pImage+nX0);
+        } else {
+          m_pSprite->pushImage(nDstX+nX0, nDstY+nY, nX-nX0, 1, (uint16_t*)(pImage+nX0));
+        }
+      }
+      nX0 = nX+1;
+    }
+    pImage += nW;
+  }
+}
+
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
 {
   const uint16_t* pImage = (const uint16_t*)pBitmap;
@@ -801,23 +876,93 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
   int16_t w = *(pImage++);
 
   // Swap the colour byte order when rendering
-  m_disp.setSwapBytes(true); 
+  DRV_DRAW(setSwapBytes(true)); 
   #if (GSLC_BMP_TRANS_EN)
     uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
-    if (bProgMem) {
-      m_disp.pushImage(nDstX, nDstY, w, h, (const uint16_t*) pImage, nTransRaw); 
-    } else {
-      m_disp.pushImage(nDstX, nDstY, w, h, (uint16_t*) pImage, nTransRaw); 
-    }
+    gslc_DrvPushImageTrans(nDstX, nDstY, w, h, pImage, bProgMem, nTransRaw);
   #else
     if (bProgMem) {
-      m_disp.pushImage(nDstX, nDstY, w, h, (const uint16_t*) pImage); 
+      DRV_DRAW(pushImage(nDstX, nDstY, w, h, (const uint16_t*) pImage)); 
     } else {
-      m_disp.pushImage(nDstX, nDstY, w, h, (uint16_t*) pImage); 
+      DRV_DRAW(pushImage(nDstX, nDstY, w, h, (uint16_t*) pImage)); 
     }
   #endif // GSLC_BMP_TRANS_EN
 }
 
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  int16_t h = (bProgMem)? pgm_read_word(pImage++) : *(pImage++);
+  int16_t w = (bProgMem)? pgm_read_word(pImage++) : *(pImage++);
+
+  // Determine the visible portion of the image
+  gslc_tsRect rImg = (gslc_tsRect){nDstX,nDstY,(uint16_t)w,(uint16_t)h};
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+#else
+  (void)pGui; // Unused
+#endif
+  int16_t nVisX1 = rImg.x + rImg.w - 1;
+  int16_t nVisY1 = rImg.y + rImg.h - 1;
+
+  // Swap the colour byte order when rendering
+  DRV_DRAW(setSwapBytes(true));
+  // Keep the display selected for all of the runs
+  if (!m_bRedrawWrite) { m_disp.startWrite(); }
+
+  int16_t  nImgX = 0;
+  int16_t  nY    = nDstY;
+  int16_t  nX0,nX1;
+  uint16_t nRun,nCnt,nColRaw;
+  while (nY <= nVisY1) {
+    nRun = (bProgMem)? pgm_read_word(pImage++) : *(pImage++);
+    nCnt = nRun & GSLC_RLE16_CNT_MASK;
+    if ((nCnt == 0) || (nImgX + nCnt > w)) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawRle16FromMem() invalid run at row %d\n",nY-nDstY);
+      break;
+    }
+    // Determine the visible portion of the run
+    nX0 = nDstX + nImgX;
+    nX1 = nX0 + nCnt - 1;
+    if (nY < rImg.y) { nX1 = nX0 - 1; }
+    if (nX0 < rImg.x) { nX0 = rImg.x; }
+    if (nX1 > nVisX1) { nX1 = nVisX1; }
+
+    switch (nRun & GSLC_RLE16_OP_MASK) {
+      case GSLC_RLE16_OP_COPY:
+        if (nX0 <= nX1) {
+          const uint16_t* pPix = pImage + (nX0 - (nDstX + nImgX));
+          if (bProgMem) {
+            DRV_DRAW(pushImage(nX0, nY, nX1-nX0+1, 1, pPix));
+          } else {
+            DRV_DRAW(pushImage(nX0, nY, nX1-nX0+1, 1, (uint16_t*)pPix));
+          }
+        }
+        pImage += nCnt;
+        break;
+      case GSLC_RLE16_OP_FILL:
+        // Solid runs become a single fill
+        nColRaw = (bProgMem)? pgm_read_word(pImage++) : *(pImage++);
+        if (nX0 <= nX1) {
+          DRV_DRAW(drawFastHLine(nX0, nY, nX1-nX0+1, nColRaw));
+        }
+        break;
+      default:
+        // Transparent runs are skipped entirely
+        break;
+    }
+
+    // Runs do not cross rows
+    nImgX += nCnt;
+    if (nImgX == w) {
+      nImgX = 0;
+      nY++;
+    }
+  }
+  if (!m_bRedrawWrite) { m_disp.endWrite(); }
+}
+
 #if (GSLC_SD_EN)
 // ----- REFERENCE CODE begin
 // The following code was based upon the following reference code but modified to
@@ -827,148 +972,108 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
 //   Original author:  Adafruit
 //   Function:         bmpDraw()
 
-// These read 16- and 32-bit types from the SD card file.
-// BMP data is stored little-endian, Arduino is little-endian too.
-// May need to reverse subscript order if porting elsewhere.
-uint16_t gslc_DrvRead16SD(fs::File &f) {
-  uint16_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read(); // MSB
-  return result;
+// SD card file access for gslc_BmpStreamOpen()
+int32_t gslc_DrvFileReadSD(void* pvFile,uint8_t* pBuf,uint16_t nLen)
+{
+  return ((fs::File*)pvFile)->read(pBuf,nLen);
 }
 
-uint32_t gslc_DrvRead32SD(fs::File &f) {
-  uint32_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read();
-  ((uint8_t *)&result)[2] = f.read();
-  ((uint8_t *)&result)[3] = f.read(); // MSB
-  return result;
+bool gslc_DrvFileSeekSD(void* pvFile,uint32_t nPos)
+{
+  return ((fs::File*)pvFile)->seek(nPos);
 }
 
 void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
 {
   File     bmpFile;
-  int      bmpWidth, bmpHeight;   // W+H in pixels
-  uint8_t  bmpDepth;              // Bit depth (currently must be 24)
-  uint32_t bmpImageoffset;        // Start of image data in file
-  uint32_t rowSize;               // Not always = bmpWidth; may have padding
-  uint8_t  sdbuffer[3*GSLC_SD_BUFFPIXEL]; // pixel buffer (R+G+B per pixel)
-  uint8_t  buffidx = sizeof(sdbuffer); // Current position in sdbuffer
-  boolean  goodBmp = false;       // Set to true on valid header parse
-  boolean  flip    = true;        // BMP is stored bottom-to-top
-  int      w, h, row, col;
-  uint8_t  r, g, b;
-  uint32_t pos = 0, startTime = millis();
-  (void)startTime; // Unused
+  uint16_t sdbuffer[(3*GSLC_SD_BUFFPIXEL+1)/2]; // BMP file buffer (one or more rows)
+  gslc_tsBmpStream  sStream;
 
   if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
 
-  //Serial.println();
-  //Serial.print("Loading image '");
-  //Serial.print(filename);
-  //Serial.println('\'');
+  // The SD card may share the bus with the display, so release it
+  bool bSuspended = m_bRedrawWrite;
+  if (bSuspended) {
+    m_disp.endWrite();
+    m_bRedrawWrite = false;
+  }
 
-  // Open requested file on SD card
+  // Open requested file on SD card and parse BMP header
+  bool bOk = false;
   if ((bmpFile = SD.open(filename)) == 0) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file not found [%s]",filename);
-    return;
+  } else if (!gslc_BmpStreamOpen(&sStream,&bmpFile,&gslc_DrvFileReadSD,&gslc_DrvFileSeekSD,
+      (uint8_t*)sdbuffer,sizeof(sdbuffer))) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
+  } else {
+    bOk = true;
   }
-  // Parse BMP header
-  if(gslc_DrvRead16SD(bmpFile) == 0x4D42) { // BMP signature
-    uint32_t nFileSize = gslc_DrvRead32SD(bmpFile);
-    (void)nFileSize; // Unused
-    //Serial.print("File size: "); Serial.println(nFileSize);
-    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
-    bmpImageoffset = gslc_DrvRead32SD(bmpFile); // Start of image data
-    //Serial.print("Image Offset: "); Serial.println(bmpImageoffset, DEC);
-    // Read DIB header
-    uint32_t nHdrSize = gslc_DrvRead32SD(bmpFile);
-    (void)nHdrSize; // Unused
-    //Serial.print("Header size: "); Serial.println(nHdrSize);
-    bmpWidth  = gslc_DrvRead32SD(bmpFile);
-    bmpHeight = gslc_DrvRead32SD(bmpFile);
-    if(gslc_DrvRead16SD(bmpFile) == 1) { // # planes -- must be '1'
-      bmpDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
-      //Serial.print("Bit Depth: "); Serial.println(bmpDepth);
-      if((bmpDepth == 24) && (gslc_DrvRead32SD(bmpFile) == 0)) { // 0 = uncompressed
-        goodBmp = true; // Supported BMP format -- proceed!
-        //Serial.print("Image size: ");
-        //Serial.print(bmpWidth);
-        //Serial.print('x');
-        //Serial.println(bmpHeight);
-
-        // BMP rows are padded (if needed) to 4-byte boundary
-        rowSize = (bmpWidth * 3 + 3) & ~3;
-
-        // If bmpHeight is negative, image is in top-down order.
-        // This is not canon but has been observed in the wild.
-        if(bmpHeight < 0) {
-          bmpHeight = -bmpHeight;
-          flip      = false;
-        }
 
-        // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
-
-        // Set TFT address window to clipped image bounds
-        //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
-
-        for (row=0; row<h; row++) { // For each scanline...
-
-          // Seek to start of scan line.  It might seem labor-
-          // intensive to be doing this on every line, but this
-          // method covers a lot of gritty details like cropping
-          // and scanline padding.  Also, the seek only takes
-          // place if the file position actually needs to change
-          // (avoids a lot of cluster math in SD library).
-          if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
-            pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
-          else     // Bitmap is stored top-to-bottom
-            pos = bmpImageoffset + row * rowSize;
-          if(bmpFile.position() != pos) { // Need seek?
-            bmpFile.seek(pos);
-            buffidx = sizeof(sdbuffer); // Force buffer reload
-          }
+  // Determine the visible portion of the image
+  // - Only the rows within it are read from the file
+  gslc_tsRect rImg = (gslc_tsRect){(int16_t)x,(int16_t)y,0,0};
+  if (bOk) {
+    rImg.w = sStream.nImgW;
+    rImg.h = sStream.nImgH;
+#if (GSLC_CLIP_EN)
+    gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+    gslc_tsRect rClip = pDriver->rClipRect;
+#else
+    gslc_tsRect rClip = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+#endif
+    bOk = gslc_ClipRect(&rClip,&rImg) &&
+      gslc_BmpStreamSetRegion(&sStream,(gslc_tsRect){(int16_t)(rImg.x-x),(int16_t)(rImg.y-y),rImg.w,rImg.h});
+  }
 
-          for (col=0; col<w; col++) { // For each pixel...
-            // Time to read more pixel data?
-            if (buffidx >= sizeof(sdbuffer)) { // Indeed
-              bmpFile.read(sdbuffer, sizeof(sdbuffer));
-              buffidx = 0; // Set index to beginning
-            }
-
-            // Convert pixel from BMP to TFT format, push to display
-            b = sdbuffer[buffidx++];
-            g = sdbuffer[buffidx++];
-            r = sdbuffer[buffidx++];
-            //xxx tft.pushColor(tft.Color565(r,g,b));
-            gslc_tsColor nCol = (gslc_tsColor){r,g,b};
-            bool bDrawBit = true;
-            if (GSLC_BMP_TRANS_EN) {
-              gslc_tsColor nColTrans = pGui->sTransCol;
-              if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
-                bDrawBit = false;
-              }
-            }
-            if (bDrawBit) {
-              gslc_DrvDrawPoint(pGui,x+col,y+row,nCol);
-            }
-
-          } // end pixel
-        } // end scanline
-        //Serial.print("Loaded in ");
-        //Serial.print(millis() - startTime);
-        //Serial.println(" ms");
-      } // end goodBmp
+  if (bOk) {
+    gslc_tsColor nColTrans = pGui->sTransCol;
+    uint16_t     nTransRaw = m_disp.color565(nColTrans.r,nColTrans.g,nColTrans.b);
+
+    // Convert each row to RGB565 in place and push it in one block write
+    // - The converted pixels are smaller than the BMP pixels, so they
+    //   never overwrite file data that has not been converted yet
+    // - Transparent pixels are skipped by pushImage()
+    DRV_DRAW(setSwapBytes(true));
+    int16_t         nImgX, nImgY;
+    uint16_t        nCnt, nInd, nColRaw;
+    uint8_t         nPixBytes = sStream.nPixBytes;
+    const uint8_t*  pPix;
+    uint16_t*       pRow;
+    uint8_t         r, g, b;
+    while ((nCnt = gslc_BmpStreamRead(&sStream,&nImgX,&nImgY,&pPix)) > 0) {
+      // Align the converted row
+      pRow = (uint16_t*)(pPix + ((uintptr_t)pPix & 1));
+      for (nInd=0; nInd<nCnt; nInd++) {
+        // BMP pixels are stored as B,G,R(,A)
+        b = pPix[0];
+        g = pPix[1];
+        r = pPix[2];
+        pPix += nPixBytes;
+        nColRaw = m_disp.color565(r,g,b);
+        if (GSLC_BMP_TRANS_EN) {
+          if ((r == nColTrans.r) && (g == nColTrans.g) && (b == nColTrans.b)) {
+            nColRaw = nTransRaw;
+          } else if (nColRaw == nTransRaw) {
+            // Keep opaque pixels that only match after conversion
+            nColRaw ^= 0x0001;
+          }
+        }
+        pRow[nInd] = nColRaw;
+      }
+      if (GSLC_BMP_TRANS_EN) {
+        gslc_DrvPushImageTrans(x+nImgX,y+nImgY,nCnt,1,pRow,false,nTransRaw);
+      } else {
+        DRV_DRAW(pushImage(x+nImgX,y+nImgY,nCnt,1,pRow));
+      }
     }
   }
-  bmpFile.close();
-  if(!goodBmp) {
-    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
+
+  if (bmpFile) {
+    bmpFile.close();
+  }
+  if (bSuspended) {
+    m_disp.startWrite();
+    m_bRedrawWrite = true;
   }
 }
 // ----- REFERENCE CODE end
@@ -1015,6 +1120,10 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // 24-bit Bitmap in ram
       gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
       return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Run-length encoded RGB565 image in ram
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
     } else {
       return false; // TODO: not yet supported
     }
@@ -1031,6 +1140,10 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // 24-bit Bitmap in flash
       gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
       return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Run-length encoded RGB565 image in flash
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
+      return true;
     } else {
       return false; // TODO: not yet supported
     }
@@ -1126,6 +1239,143 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
 }
 
 
+uint32_t gslc_DrvReadRectLen(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  (void)pGui; // Unused
+  return (uint32_t)rRect.w * rRect.h * sizeof(uint16_t);
+}
+
+// Determine if a region lies within the selected sprite or else the display
+static bool gslc_DrvRectInTarget(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  int16_t nTargetW = pGui->nDispW;
+  int16_t nTargetH = pGui->nDispH;
+  if (pDriver->pSpriteSel != NULL) {
+    nTargetW = pDriver->pSpriteSel->nW;
+    nTargetH = pDriver->pSpriteSel->nH;
+  }
+  return ((rRect.x >= 0) && (rRect.y >= 0) &&
+    (rRect.x + rRect.w <= nTargetW) && (rRect.y + rRect.h <= nTargetH));
+}
+
+bool gslc_DrvReadRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf)
+{
+  if ((pGui == NULL) || (pBuf == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvReadRect(%s) with NULL ptr\n","");
+    return false;
+  }
+  if (!gslc_DrvRectInTarget(pGui,rRect)) {
+    return false;
+  }
+  if (m_pSprite != NULL) {
+    // Sprites are read from RAM without using the bus
+    m_pSprite->readRect(rRect.x,rRect.y,rRect.w,rRect.h,(uint16_t*)pBuf);
+    return true;
+  }
+  // Reading from the display can't be done within a write transaction
+  if (m_bRedrawWrite) { m_disp.endWrite(); }
+  m_disp.readRect(rRect.x,rRect.y,rRect.w,rRect.h,(uint16_t*)pBuf);
+  if (m_bRedrawWrite) { m_disp.startWrite(); }
+  return true;
+}
+
+bool gslc_DrvWriteRect(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf)
+{
+  if ((pGui == NULL) || (pBuf == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvWriteRect(%s) with NULL ptr\n","");
+    return false;
+  }
+  if (!gslc_DrvRectInTarget(pGui,rRect)) {
+    return false;
+  }
+  // readRect() returns the pixels in the byte order that pushRect()
+  // expects when byte swapping is disabled
+  bool bSwap = DRV_DRAW(getSwapBytes());
+  DRV_DRAW(setSwapBytes(false));
+  DRV_DRAW(pushRect(rRect.x,rRect.y,rRect.w,rRect.h,(uint16_t*)pBuf));
+  DRV_DRAW(setSwapBytes(bSwap));
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Sprite Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvSpriteCreate(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,uint16_t nW,uint16_t nH)
+{
+  if ((pGui == NULL) || (pSprite == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate(%s) with NULL ptr\n","");
+    return false;
+  }
+  pSprite->nW       = nW;
+  pSprite->nH       = nH;
+  pSprite->pvSprite = NULL;
+  if ((nW == 0) || (nH == 0)) {
+    return false;
+  }
+  // Sprites hold RGB565 pixels so that they push without conversion
+  TFT_eSprite* pSpr = new TFT_eSprite(&m_disp);
+  pSpr->setColorDepth(16);
+  if (pSpr->createSprite(nW,nH) == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpriteCreate() failed to allocate %ux%u sprite\n",nW,nH);
+    delete pSpr;
+    return false;
+  }
+  pSpr->fillSprite(TFT_BLACK);
+  pSprite->pvSprite = (void*)pSpr;
+  return true;
+}
+
+void gslc_DrvSpriteDestruct(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite)
+{
+  if ((pGui == NULL) || (pSprite == NULL)) {
+    return;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSpriteSel == pSprite) {
+    gslc_DrvSpriteSelect(pGui,NULL);
+  }
+  if (pSprite->pvSprite) {
+    TFT_eSprite* pSpr = (TFT_eSprite*)pSprite->pvSprite;
+    pSpr->deleteSprite();
+    delete pSpr;
+    pSprite->pvSprite = NULL;
+  }
+}
+
+bool gslc_DrvSpriteSelect(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if ((pSprite != NULL) && (pSprite->pvSprite == NULL)) {
+    return false;
+  }
+  pDriver->pSpriteSel = pSprite;
+  m_pSprite = (pSprite != NULL)? (TFT_eSprite*)pSprite->pvSprite : NULL;
+  // Each target keeps its own font state
+  pDriver->pvFontLast = NULL;
+  gslc_DrvSetClipRect(pGui,NULL);
+  return true;
+}
+
+bool gslc_DrvSpritePush(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,int16_t nDstX,int16_t nDstY)
+{
+  if ((pGui == NULL) || (pSprite == NULL) || (pSprite->pvSprite == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpritePush(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSpriteSel != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSpritePush() called while a sprite is selected%s\n","");
+    return false;
+  }
+  // Clipping is applied by the display viewport
+  ((TFT_eSprite*)pSprite->pvSprite)->pushSprite(nDstX,nDstY);
+  return true;
+}
+
+
 // -----------------------------------------------------------------------
 // Touch Functions (via display driver)
 // -----------------------------------------------------------------------
@@ -127,6 +127,8 @@ extern "C" {
 
 #define DRV_HAS_DRAW_POINTS            0 ///< Support gslc_DrvDrawPoints()
 #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_LINES             0 ///< Support gslc_DrvDrawLines()
+#define DRV_HAS_DRAW_SPANS             0 ///< Support gslc_DrvDrawSpans()
 #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
 #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
 #define DRV_HAS_DRAW_RECT_ROUND_FRAME  1 ///< Support gslc_DrvDrawFrameRoundRect()
@@ -139,10 +141,25 @@ extern "C" {
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
 
 #define DRV_OVERRIDE_TXT_ALIGN         1 ///< Driver provides text alignment
+// Hold one display bus transaction across each page redraw
+// (may be disabled in the config to compare bus activity)
+#if !defined(DRV_HAS_REDRAW_BATCH)
+  #define DRV_HAS_REDRAW_BATCH         1 ///< Support gslc_DrvRedrawBegin() / gslc_DrvRedrawEnd()
+#endif
+#define DRV_HAS_READ_RECT              1 ///< Support gslc_DrvReadRect() / gslc_DrvWriteRect()
+#define DRV_HAS_SPRITE                 1 ///< Support gslc_DrvSpriteCreate() and off-screen drawing
 
 // =======================================================================
 // Driver-specific members
 // =======================================================================
+
+/// Off-screen drawing surface (sprite)
+typedef struct {
+  uint16_t      nW;             ///< Width of the sprite
+  uint16_t      nH;             ///< Height of the sprite
+  void*         pvSprite;       ///< TFT_eSprite instance (NULL if not created)
+} gslc_tsDrvSprite;
+
 typedef struct {
   gslc_tsColor  nColBkgnd;      ///< Background color (if not image-based)
 
@@ -150,6 +167,8 @@ typedef struct {
 
   const void*   pvFontLast;     ///< Last loadFont() reference
 
+  gslc_tsDrvSprite* pSpriteSel; ///< Sprite that drawing is directed to (NULL for the display)
+
 } gslc_tsDriver;
 
 
@@ -424,6 +443,28 @@ bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,i
 // Screen Management Functions
 // -----------------------------------------------------------------------
 
+///
+/// Start a page redraw
+/// - Called before the elements are drawn by gslc_PageRedrawGo() so
+///   that the display bus transaction can be held open for the
+///   entire redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvRedrawBegin(gslc_tsGui* pGui);
+
+///
+/// Finish a page redraw
+/// - Releases the display bus transaction opened by gslc_DrvRedrawBegin()
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvRedrawEnd(gslc_tsGui* pGui);
+
 ///
 /// Force a page flip to occur. This generally copies active
 /// screen surface to the display.
@@ -640,6 +681,21 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, cons
 ///
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
 
+///
+/// Draw a run-length encoded RGB565 bitmap from a memory array
+/// - See GSLC_IMGREF_FMT_RLE16 for the array format
+/// - Solid runs are drawn as fills and transparent runs are skipped
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
 #if (GSLC_SPIFFS_EN)
 ///
 /// This routine uses TFT_eFEX library to draw a BMP file stored in SPIFFS file system
@@ -678,6 +734,104 @@ bool gslc_DrvDrawJpegFromFile(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_
 void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
 
 
+///
+/// Get the buffer size required by gslc_DrvReadRect() for a region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display
+///
+/// \return Number of bytes required
+///
+uint32_t gslc_DrvReadRectLen(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
+///
+/// Copy a region of the display into a buffer
+/// - Reads from the sprite selected by gslc_DrvSpriteSelect() if any
+/// - The pixels are stored row by row in the driver's native format
+/// - The region must lie within the display (or the selected sprite)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display to read
+/// \param[out] pBuf:        Buffer of at least gslc_DrvReadRectLen() bytes
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvReadRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf);
+
+
+///
+/// Write a buffer captured by gslc_DrvReadRect() back to the display
+/// - Writes to the sprite selected by gslc_DrvSpriteSelect() if any
+/// - The clipping region is not applied
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display to write
+/// \param[in]  pBuf:        Buffer from gslc_DrvReadRect() for the same region
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvWriteRect(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf);
+
+
+// -----------------------------------------------------------------------
+// Sprite Functions
+// -----------------------------------------------------------------------
+
+///
+/// Create an off-screen drawing surface (sprite)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pSprite:     Pointer to sprite to initialize
+/// \param[in]  nW:          Width of the sprite
+/// \param[in]  nH:          Height of the sprite
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpriteCreate(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,uint16_t nW,uint16_t nH);
+
+
+///
+/// Release the resources associated with a sprite
+/// - If the sprite is selected, drawing reverts to the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite
+///
+/// \return none
+///
+void gslc_DrvSpriteDestruct(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite);
+
+
+///
+/// Direct all subsequent drawing to a sprite or back to the display
+/// - While a sprite is selected, drawing coordinates are relative
+///   to the top-left corner of the sprite
+/// - The clipping region is reset to the whole of the new target
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite (or NULL for the display)
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpriteSelect(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite);
+
+
+///
+/// Copy the contents of a sprite to the display
+/// - The display must be the current drawing target
+/// - The copy is limited by the clipping region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pSprite:     Pointer to sprite
+/// \param[in]  nDstX:       X coordinate of the top-left corner on the display
+/// \param[in]  nDstY:       Y coordinate of the top-left corner on the display
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSpritePush(gslc_tsGui* pGui,gslc_tsDrvSprite* pSprite,int16_t nDstX,int16_t nDstY);
+
+
 // -----------------------------------------------------------------------
 // Touch Functions (if using display driver library)
 // -----------------------------------------------------------------------
@@ -110,6 +110,7 @@ gslc_tsElemRef* gslc_ElemXGaugeCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   pXData->colTick         = GSLC_COL_GRAY;
   pXData->nTickCnt        = 8;
   pXData->nTickLen        = 5;
+  gslc_PolarCacheAdd(pGui,64*(360/pXData->nTickCnt));
   pXData->nIndicLen       = 10;     // Dummy default to be overridden
   pXData->nIndicTip       = 3;      // Dummy default to be overridden
   pXData->bIndicFill      = false;
@@ -190,6 +191,11 @@ void gslc_ElemXGaugeSetTicks(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsCo
   pGauge->nTickCnt  = nTickCnt;
   pGauge->nTickLen  = nTickLen;
 
+  // Cache the tick directions
+  if (nTickCnt > 0) {
+    gslc_PolarCacheAdd(pGui,64*(360/nTickCnt));
+  }
+
   // Just in case we were called at runtime, mark as needing redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
@@ -474,18 +480,22 @@ void gslc_ElemXGaugeDrawRadialHelp(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16
   int16_t   nBaseX1,nBaseY1,nBaseX2,nBaseY2;
   int16_t   nTipBaseX,nTipBaseY;
 
-  gslc_PolarToXY(nArrowLen,n64Ang,&nTipX,&nTipY);
-  gslc_PolarToXY(nArrowLen-nArrowSz,n64Ang,&nTipBaseX,&nTipBaseY);
-  gslc_PolarToXY(nArrowSz,n64Ang-90*64,&nBaseX1,&nBaseY1);
-  gslc_PolarToXY(nArrowSz,n64Ang+90*64,&nBaseX2,&nBaseY2);
+  gslc_PolarToXYCache(pGui,nArrowLen,n64Ang,&nTipX,&nTipY);
+  gslc_PolarToXYCache(pGui,nArrowLen-nArrowSz,n64Ang,&nTipBaseX,&nTipBaseY);
+  gslc_PolarToXYCache(pGui,nArrowSz,n64Ang-90*64,&nBaseX1,&nBaseY1);
+  gslc_PolarToXYCache(pGui,nArrowSz,n64Ang+90*64,&nBaseX2,&nBaseY2);
 
   if (!bFill) {
     // Framed
-    gslc_DrawLine(pGui,nX+nBaseX1,nY+nBaseY1,nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX2,nY+nBaseY2,nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY,nX+nTipX,nY+nTipY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY,nX+nTipX,nY+nTipY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX1,nY+nBaseY1,nX+nBaseX2,nY+nBaseY2,colFrame);
+    // - Trace the outline of the pointer and return to the start
+    gslc_tsPt asPt[6];
+    asPt[0] = (gslc_tsPt){nX+nBaseX1,nY+nBaseY1};
+    asPt[1] = (gslc_tsPt){nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY};
+    asPt[2] = (gslc_tsPt){nX+nTipX,nY+nTipY};
+    asPt[3] = (gslc_tsPt){nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY};
+    asPt[4] = (gslc_tsPt){nX+nBaseX2,nY+nBaseY2};
+    asPt[5] = asPt[0];
+    gslc_DrawPolyline(pGui,asPt,6,colFrame);
 
   } else {
     // Filled
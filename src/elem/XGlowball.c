@@ -112,6 +112,7 @@ gslc_tsElemRef* gslc_ElemXGlowballCreate(gslc_tsGui* pGui, int16_t nElemId, int1
   // Initialize any pxData members with default parameters
   pXData->nVal = 0;
   pXData->nQuality = 72;
+  gslc_PolarCacheAdd(pGui, 64 * 360 / pXData->nQuality);
   pXData->nAngStart = 0;
   pXData->nAngEnd = 360;
   pXData->pRings = pRings;
@@ -159,13 +160,13 @@ void drawXGlowballArc(gslc_tsGui* pGui, gslc_tsXGlowball* pGlowball, int16_t nMi
     nAng64 = nSegInd * nStep64;
     nAng64 = nAng64 % (360 * 64);
 
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
+    gslc_PolarToXYCache(pGui, nRad1, nAng64, &nX, &nY);
     anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
+    gslc_PolarToXYCache(pGui, nRad2, nAng64, &nX, &nY);
     anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarToXYCache(pGui, nRad2, nAng64 + nStep64, &nX, &nY);
     anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarToXYCache(pGui, nRad1, nAng64 + nStep64, &nX, &nY);
     anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
 
     gslc_DrawFillQuad(pGui, anPts, cArc);
@@ -261,6 +262,9 @@ void gslc_ElemXGlowballSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, ui
   // Update the rendering quality setting
   pGlowball->nQuality = nQuality;
 
+  // Cache the segment boundary directions
+  gslc_PolarCacheAdd(pGui, 64 * 360 / nQuality);
+
   // Mark for redraw
   // - Force full redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
@@ -97,6 +97,21 @@ gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
 
   pXData->colGraph        = colGraph;
   pXData->eStyle          = GSLCX_GRAPH_STYLE_DOT;
+  pXData->eMode           = GSLCX_GRAPH_MODE_SCROLL;
+
+  pXData->bDrawnValid     = false;
+  pXData->nDrawnStart     = 0;
+  pXData->nAddCnt         = 0;
+  pXData->nSweepX         = 0;
+
+  // Decimation is disabled until an envelope buffer is provided
+  pXData->pEnvMin         = NULL;
+  pXData->pEnvMax         = NULL;
+  pXData->nEnvColMax      = 0;
+  pXData->nEnvPerCol      = 1;
+  pXData->nEnvFill        = 0;
+  pXData->nEnvHead        = 0;
+  pXData->nEnvAddCnt      = 0;
 
   // Define the visible region of the window
   // - The range in value can be overridden by the user
@@ -172,6 +187,21 @@ void gslc_ElemXGraphSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
 
 }
 
+void gslc_ElemXGraphSetMode(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
+        gslc_teXGraphMode eMode)
+{
+  gslc_tsXGraph*  pBox;
+  gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  pBox = (gslc_tsXGraph*)(pElem->pXData);
+
+  pBox->eMode = eMode;
+
+  // Set the redraw flag
+  // - The columns are arranged differently in each mode
+  //   so force a full redraw
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
+
 // TODO: Support scaling in X direction
 void gslc_ElemXGraphSetRange(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
         int16_t nYMin,int16_t nYMax)
@@ -218,6 +248,83 @@ void gslc_ElemXGraphScrollSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t
 }
 
 
+// Get the number of columns shown in the window
+static uint16_t gslc_ElemXGraphGetColMax(gslc_tsXGraph* pBox)
+{
+  if (pBox->pEnvMin) {
+    return pBox->nEnvColMax;
+  }
+  return (pBox->nBufMax < pBox->nPlotIndMax)? pBox->nBufMax : pBox->nPlotIndMax;
+}
+
+// Accumulate a data value into the newest decimation envelope
+// - Once the newest envelope has collected nEnvPerCol values,
+//   the next value starts a new envelope in place of the oldest
+static void gslc_ElemXGraphEnvAdd(gslc_tsXGraph* pBox,int16_t nVal)
+{
+  if (pBox->nEnvFill >= pBox->nEnvPerCol) {
+    pBox->nEnvHead = (pBox->nEnvHead+1) % pBox->nEnvColMax;
+    pBox->pEnvMin[pBox->nEnvHead] = nVal;
+    pBox->pEnvMax[pBox->nEnvHead] = nVal;
+    pBox->nEnvFill = 1;
+    if (pBox->nEnvAddCnt < pBox->nEnvColMax) {
+      pBox->nEnvAddCnt++;
+    }
+  } else {
+    if (nVal < pBox->pEnvMin[pBox->nEnvHead]) { pBox->pEnvMin[pBox->nEnvHead] = nVal; }
+    if (nVal > pBox->pEnvMax[pBox->nEnvHead]) { pBox->pEnvMax[pBox->nEnvHead] = nVal; }
+    pBox->nEnvFill++;
+  }
+}
+
+// Recalculate the decimation envelopes from the buffer contents
+static void gslc_ElemXGraphEnvRebuild(gslc_tsXGraph* pBox)
+{
+  if (!pBox->pEnvMin) {
+    return;
+  }
+  // Each column covers enough values so that the whole
+  // buffer fits within the window
+  pBox->nEnvPerCol = (pBox->nBufMax + pBox->nEnvColMax - 1) / pBox->nEnvColMax;
+  if (pBox->nEnvPerCol == 0) {
+    pBox->nEnvPerCol = 1;
+  }
+  memset(pBox->pEnvMin,0,pBox->nEnvColMax*sizeof(int16_t));
+  memset(pBox->pEnvMax,0,pBox->nEnvColMax*sizeof(int16_t));
+  pBox->nEnvHead = pBox->nEnvColMax-1;
+  pBox->nEnvFill = pBox->nEnvPerCol;
+
+  // Replay the buffer from the oldest value
+  for (uint16_t nInd=0;nInd<pBox->nBufMax;nInd++) {
+    gslc_ElemXGraphEnvAdd(pBox,pBox->pBuf[(pBox->nBufCnt + nInd) % pBox->nBufMax]);
+  }
+  pBox->nEnvAddCnt = 0;
+}
+
+void gslc_ElemXGraphSetDecimate(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
+        int16_t* pEnvBuf,uint16_t nEnvMax)
+{
+  gslc_tsXGraph*  pBox;
+  gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  pBox = (gslc_tsXGraph*)(pElem->pXData);
+
+  if ((pEnvBuf == NULL) || (nEnvMax == 0) || (pBox->nPlotIndMax == 0)) {
+    pBox->pEnvMin     = NULL;
+    pBox->pEnvMax     = NULL;
+    pBox->nEnvColMax  = 0;
+  } else {
+    // Limit the envelopes to the width of the window
+    pBox->nEnvColMax  = (nEnvMax < pBox->nPlotIndMax)? nEnvMax : pBox->nPlotIndMax;
+    pBox->pEnvMin     = pEnvBuf;
+    pBox->pEnvMax     = pEnvBuf + pBox->nEnvColMax;
+    gslc_ElemXGraphEnvRebuild(pBox);
+  }
+
+  // Set the redraw flag
+  // - The column mapping has changed so force a full redraw
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
+
 // Write a data value to the buffer
 // - Advance the write ptr, wrap if needed
 // - If encroach upon buffer read ptr, then drop the oldest line from the buffer
@@ -234,6 +341,19 @@ void gslc_ElemXGraphAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nVal)
   // - Wrap the pointers around end of buffer
   pBox->nBufCnt = (pBox->nBufCnt+1) % pBox->nBufMax;
 
+  // Update the decimation envelopes
+  if (pBox->pEnvMin) {
+    gslc_ElemXGraphEnvAdd(pBox,nVal);
+  }
+
+  // Keep track of the values that the next incremental
+  // redraw needs to render
+  if (pBox->nAddCnt < pBox->nBufMax) {
+    pBox->nAddCnt++;
+  }
+  uint16_t nColMax = gslc_ElemXGraphGetColMax(pBox);
+  pBox->nSweepX = (nColMax)? (pBox->nSweepX+1) % nColMax : 0;
+
   // Set the redraw flag
   // - Only need incremental redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
@@ -248,6 +368,8 @@ void gslc_ElemXGraphReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef) {
 
   pBox->nBufCnt  = 0;
   pBox->nPlotIndStart   = 0;
+  pBox->nAddCnt  = 0;
+  pBox->nSweepX  = 0;
 
   // Default scale is
   // - Each data point (buffer row) gets 1 pixel in X direction
@@ -257,6 +379,7 @@ void gslc_ElemXGraphReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef) {
   pBox->nPlotIndMax   = pBox->nWndWidth;
 
   memset(pBox->pBuf,0,pBox->nBufMax*sizeof(int16_t));
+  gslc_ElemXGraphEnvRebuild(pBox);
 
   // Set the redraw flag
   // - As we are clearing the buffer, force a full redraw
@@ -265,6 +388,234 @@ void gslc_ElemXGraphReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef) {
 }
 
 
+// Calculate the buffer row shown in the first column of the
+// window based on the current buffer write pointer and scroll
+// position
+static uint16_t gslc_ElemXGraphGetWndStart(gslc_tsXGraph* pBox)
+{
+  uint16_t nScrollMax = pBox->nBufMax - pBox->nPlotIndMax;
+  uint16_t nIndStart  = pBox->nBufMax + pBox->nBufCnt;
+  nIndStart -= pBox->nPlotIndMax;
+  // Only correct for scrollbar position if enabled
+  if (pBox->bScrollEn) {
+    nIndStart -= (nScrollMax - pBox->nScrollPos);
+  }
+  return pBox->nBufMax ? (nIndStart % pBox->nBufMax) : 0;
+}
+
+// Calculate the height of a data value above the base of the window
+static uint16_t gslc_ElemXGraphGetValOffset(gslc_tsXGraph* pBox,int16_t nDataVal)
+{
+  uint16_t nPixYOffset;
+
+  // Clip the value to the plot range
+  if      (nDataVal > pBox->nPlotValMax) { nDataVal = pBox->nPlotValMax; }
+  else if (nDataVal < pBox->nPlotValMin) { nDataVal = pBox->nPlotValMin; }
+
+  // TODO: Scale data value
+
+  // Calculate Y value
+  nPixYOffset = (nDataVal >= 0)? nDataVal : 0;
+  // Clip plot Y value
+  if (nPixYOffset > pBox->nWndHeight) { nPixYOffset = pBox->nWndHeight; }
+  return nPixYOffset;
+}
+
+// Draw a window column between two heights (inclusive)
+static void gslc_ElemXGraphDrawSpan(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXGraph* pBox,
+  uint16_t nCurX,uint16_t nOffset0,uint16_t nOffset1,gslc_tsColor nCol)
+{
+  // Determine the drawing coordinates
+  uint16_t nPixX     = pElem->rElem.x + pBox->nMargin + nCurX;
+  uint16_t nPixYBase = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
+
+  if (nOffset0 == nOffset1) {
+    gslc_DrawSetPixel(pGui,nPixX,nPixYBase-nOffset0,nCol);
+  } else {
+    gslc_DrawLine(pGui,nPixX,nPixYBase-nOffset0,nPixX,nPixYBase-nOffset1,nCol);
+  }
+}
+
+// Fetch the range of heights of the data shown in a window column
+// - With decimation, a column shows the envelope of several values
+// - Returns false for the blank column at the sweep cursor
+// - For GSLCX_GRAPH_MODE_SCROLL, nPlotIndStart must be up to date
+static bool gslc_ElemXGraphGetCol(gslc_tsXGraph* pBox,uint16_t nCurX,
+  uint16_t* pnOffsetMin,uint16_t* pnOffsetMax)
+{
+  uint16_t  nColMax = gslc_ElemXGraphGetColMax(pBox);
+  bool      bSweep  = (pBox->eMode == GSLCX_GRAPH_MODE_SWEEP);
+  uint16_t  nInd;
+  int16_t   nValMin,nValMax;
+
+  if (pBox->pEnvMin) {
+    if (bSweep) {
+      // Envelopes are stored in the column they are shown in
+      if (nCurX == (pBox->nEnvHead+1) % nColMax) {
+        return false;
+      }
+      nInd = nCurX;
+    } else {
+      // The oldest envelope is shown in the first column
+      nInd = (pBox->nEnvHead + 1 + nCurX) % nColMax;
+    }
+    nValMin = pBox->pEnvMin[nInd];
+    nValMax = pBox->pEnvMax[nInd];
+  } else {
+    if (bSweep) {
+      // Each value is shown in the column that the cursor
+      // was at when it was added
+      if (nCurX == pBox->nSweepX) {
+        return false;
+      }
+      uint16_t nBack = (pBox->nSweepX + nColMax - 1 - nCurX) % nColMax + 1;
+      nInd = (pBox->nBufMax + pBox->nBufCnt - nBack) % pBox->nBufMax;
+    } else {
+      // Calculate row offset after accounting for buffer wrap
+      // and current window starting offset
+      nInd = (pBox->nPlotIndStart + nCurX) % pBox->nBufMax;
+    }
+    // NOTE: At the start of buffer fill when we have
+    // only written a few values, we will continue to read
+    // values out of the buffer so we are dependent upon
+    // the reset to initialize the buffer to zero.
+    nValMin = pBox->pBuf[nInd];
+    nValMax = nValMin;
+  }
+
+  *pnOffsetMin = gslc_ElemXGraphGetValOffset(pBox,nValMin);
+  *pnOffsetMax = gslc_ElemXGraphGetValOffset(pBox,nValMax);
+  return true;
+}
+
+// Render the data of a window column that has already been cleared
+// - In GSLCX_GRAPH_STYLE_LINE without decimation, the line is
+//   drawn by gslc_ElemXGraphDrawLine() instead
+static void gslc_ElemXGraphDrawCol(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXGraph* pBox,
+  uint16_t nCurX,gslc_tsColor colGraph)
+{
+  uint16_t nOffsetMin,nOffsetMax;
+  uint16_t nPrevMin,nPrevMax;
+
+  if (!gslc_ElemXGraphGetCol(pBox,nCurX,&nOffsetMin,&nOffsetMax)) {
+    return;
+  }
+
+  if (pBox->eStyle == GSLCX_GRAPH_STYLE_DOT) {
+    gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,nOffsetMin,nOffsetMax,colGraph);
+  } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) {
+    if (pBox->pEnvMin) {
+      // Extend the envelope to meet the envelope of the
+      // previous column so that the line stays connected
+      if ((nCurX > 0) && gslc_ElemXGraphGetCol(pBox,nCurX-1,&nPrevMin,&nPrevMax)) {
+        if (nPrevMax < nOffsetMin) { nOffsetMin = nPrevMax; }
+        if (nPrevMin > nOffsetMax) { nOffsetMax = nPrevMin; }
+      }
+      gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,nOffsetMin,nOffsetMax,colGraph);
+    }
+  } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) {
+    gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,0,nOffsetMax,colGraph);
+  }
+}
+
+// Replace the contents of a window column
+static void gslc_ElemXGraphDrawColRepl(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXGraph* pBox,
+  uint16_t nCurX,gslc_tsColor colGraph,gslc_tsColor colFill)
+{
+  uint16_t nOffsetMin,nOffsetMax;
+
+  if ((pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) && gslc_ElemXGraphGetCol(pBox,nCurX,&nOffsetMin,&nOffsetMax)) {
+    // Erase only the part of the column above the bar
+    gslc_ElemXGraphDrawCol(pGui,pElem,pBox,nCurX,colGraph);
+    if (nOffsetMax < pBox->nWndHeight) {
+      gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,nOffsetMax+1,pBox->nWndHeight,colFill);
+    }
+  } else {
+    gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,0,pBox->nWndHeight,colFill);
+    gslc_ElemXGraphDrawCol(pGui,pElem,pBox,nCurX,colGraph);
+  }
+}
+
+// Maximum number of points passed in each polyline batch
+#define GSLCX_GRAPH_LINE_BATCH  16
+
+// Draw the connected line through the values in a range of
+// window columns (inclusive) for GSLCX_GRAPH_STYLE_LINE
+// - The blank column at the sweep cursor breaks the line
+// - The points are batched so that each run of connected
+//   segments is drawn as a polyline
+static void gslc_ElemXGraphDrawLine(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXGraph* pBox,
+  int16_t nColStart,int16_t nColEnd,gslc_tsColor colGraph)
+{
+  int16_t     nColMax   = (int16_t)gslc_ElemXGraphGetColMax(pBox);
+  int16_t     nPixYBase = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
+  gslc_tsPt   asPt[GSLCX_GRAPH_LINE_BATCH];
+  uint8_t     nPtCnt = 0;
+  uint16_t    nOffsetMin,nOffsetMax;
+
+  if (nColStart < 0) { nColStart = 0; }
+  if (nColEnd >= nColMax) { nColEnd = nColMax-1; }
+
+  for (int16_t nCurX=nColStart;nCurX<=nColEnd;nCurX++) {
+    if (!gslc_ElemXGraphGetCol(pBox,nCurX,&nOffsetMin,&nOffsetMax)) {
+      // End the current run
+      gslc_DrawPolyline(pGui,asPt,nPtCnt,colGraph);
+      nPtCnt = 0;
+      continue;
+    }
+    if (nPtCnt == GSLCX_GRAPH_LINE_BATCH) {
+      // Continue the run from the last point of the batch
+      gslc_DrawPolyline(pGui,asPt,nPtCnt,colGraph);
+      asPt[0] = asPt[nPtCnt-1];
+      nPtCnt = 1;
+    }
+    asPt[nPtCnt].x = pElem->rElem.x + pBox->nMargin + nCurX;
+    asPt[nPtCnt].y = nPixYBase - nOffsetMax;
+    nPtCnt++;
+  }
+  gslc_DrawPolyline(pGui,asPt,nPtCnt,colGraph);
+}
+
+// Change the data point rendered in a column by only
+// erasing and drawing the pixels that differ
+static void gslc_ElemXGraphDrawValDiff(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXGraph* pBox,
+  uint16_t nCurX,uint16_t nOffsetOld,uint16_t nOffsetNew,gslc_tsColor colGraph,gslc_tsColor colFill)
+{
+  if (nOffsetOld == nOffsetNew) {
+    return;
+  }
+  if (pBox->eStyle == GSLCX_GRAPH_STYLE_DOT) {
+    gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,nOffsetOld,nOffsetOld,colFill);
+    gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,nOffsetNew,nOffsetNew,colGraph);
+  } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) {
+    if (nOffsetNew > nOffsetOld) {
+      gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,nOffsetOld+1,nOffsetNew,colGraph);
+    } else {
+      gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nCurX,nOffsetNew+1,nOffsetOld,colFill);
+    }
+  }
+}
+
+// Determine if the values shown at the last redraw are still in
+// the buffer, in which case an incremental redraw can compare
+// them against the new values
+// - The values added since the last redraw were written starting
+//   at the old write pointer, so they must not have overwritten
+//   any row of the old window
+static bool gslc_ElemXGraphIncValid(gslc_tsXGraph* pBox)
+{
+  if (pBox->nAddCnt == 0) {
+    return true;
+  }
+  if (pBox->nAddCnt >= pBox->nBufMax) {
+    return false;
+  }
+  uint16_t nColMax  = gslc_ElemXGraphGetColMax(pBox);
+  uint16_t nCntOld  = (pBox->nBufMax + pBox->nBufCnt - pBox->nAddCnt) % pBox->nBufMax;
+  uint16_t nDist    = (pBox->nBufMax + pBox->nDrawnStart - nCntOld) % pBox->nBufMax;
+  return (pBox->nAddCnt <= nDist) && (nDist + nColMax <= pBox->nBufMax);
+}
+
 bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 {
   if ((pvGui == NULL) || (pvElemRef == NULL)) {
@@ -295,91 +646,120 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
     }
   }
 
-  // Clear the background (inset from frame)
-  // TODO: Support incremental redraw in which case we don't
-  //       erase the inner region. Instead we would just erase
-  //       old values and redraw new ones
-  gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
-  gslc_DrawFillRect(pGui,rInner,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
-
-  int16_t           nDataVal;
-  uint16_t          nCurX = 0;
-  uint16_t          nPixX,nPixY,nPixYBase,nPixYOffset;
-  gslc_tsColor      colGraph;
-
-  uint16_t          nScrollMax;
-
-  // Initialize color state
-  colGraph  = pBox->colGraph;
-
-  // Calculate the current window position based on
-  // the current buffer write pointer and scroll
-  // position
-  nScrollMax           = pBox->nBufMax - pBox->nPlotIndMax;
-  pBox->nPlotIndStart  = pBox->nBufMax + pBox->nBufCnt;
-  pBox->nPlotIndStart -= pBox->nPlotIndMax;
-  // Only correct for scrollbar position if enabled
-  if (pBox->bScrollEn) {
-    pBox->nPlotIndStart -= (nScrollMax - pBox->nScrollPos);
+  uint16_t          nColMax   = gslc_ElemXGraphGetColMax(pBox);
+  gslc_tsColor      colGraph  = pBox->colGraph;
+  gslc_tsColor      colFill   = (bGlow)?pElem->colElemFillGlow:pElem->colElemFill;
+  bool              bSweep    = (pBox->eMode == GSLCX_GRAPH_MODE_SWEEP);
+  bool              bPolyline = (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) && (!pBox->pEnvMin);
+  uint16_t          nPlotInd  = 0;
+
+  // Calculate the current window position
+  pBox->nPlotIndStart = gslc_ElemXGraphGetWndStart(pBox);
+
+  // In sweep mode, determine the columns to replace, which end
+  // at the blank column at the sweep cursor
+  uint16_t nSweepCur = (pBox->pEnvMin)? (pBox->nEnvHead+1) % nColMax : pBox->nSweepX;
+  uint16_t nSweepNew = pBox->nAddCnt;
+  if (pBox->pEnvMin) {
+    // The newest envelope at the last redraw may have been extended
+    nSweepNew = (pBox->nAddCnt > 0)? pBox->nEnvAddCnt+1 : 0;
+  }
+  uint16_t nSweepCnt = nSweepNew+1;
+  if (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) {
+    // The column after the cursor was previously connected to
+    // the cursor column
+    nSweepCnt++;
   }
-  pBox->nPlotIndStart = pBox->nBufMax ? (pBox->nPlotIndStart % pBox->nBufMax) : 0;
-  
-  uint16_t nPlotInd = 0;
-  uint16_t nIndMax = 0;
-  nIndMax = (pBox->nBufMax < pBox->nPlotIndMax)? pBox->nBufMax : pBox->nPlotIndMax;
-  for (nPlotInd=0;nPlotInd<nIndMax;nPlotInd++) {
-
-    // Calculate row offset after accounting for buffer wrap
-    // and current window starting offset
-    uint16_t nBufInd = pBox->nPlotIndStart + nPlotInd;
-    nBufInd = nBufInd % pBox->nBufMax;
-
-    // NOTE: At the start of buffer fill when we have
-    // only written a few values, we will continue to read
-    // values out of the buffer so we are dependent upon
-    // the reset to initialize the buffer to zero.
-
-    nDataVal = pBox->pBuf[nBufInd];
-
-    // Clip the value to the plot range
-    if      (nDataVal > pBox->nPlotValMax) { nDataVal = pBox->nPlotValMax; }
-    else if (nDataVal < pBox->nPlotValMin) { nDataVal = pBox->nPlotValMin; }
-
-    // TODO: Make nCurX a scaled version of nPlotInd
-    // - Support different modes for mapping multiple data points
-    //   a single X coordinate and mapping a single data point
-    //   to multiple X coordinates
-    // - For now, just have a 1:1 correspondence between data
-    //   points and the X coordinate
-    nCurX = nPlotInd;
-
-    // TODO: Scale data value
-
-    // TODO: Consider supporting various color mapping modes
-    //colGraph = gslc_ColorBlend2(GSLC_COL_BLACK,GSLC_COL_WHITE,500,nDataVal*500/200);
 
-    // Determine the drawing coordinates
-    nPixX       = pElem->rElem.x + pBox->nMargin + nCurX;
-    nPixYBase   = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
+  // Determine if an incremental redraw is possible. Otherwise
+  // the window is cleared and every column is redrawn.
+  bool bRedrawAll = (eRedraw == GSLC_REDRAW_FULL) || !pBox->bDrawnValid;
+  if (bSweep) {
+    // Every column changes if the cursor has wrapped
+    bRedrawAll |= (nSweepCnt >= nColMax);
+  } else if (pBox->pEnvMin) {
+    // The columns only shift when a new envelope is started
+    bRedrawAll |= (pBox->nEnvAddCnt > 0);
+  } else {
+    bRedrawAll |= !gslc_ElemXGraphIncValid(pBox);
+  }
 
-    // Calculate Y value
-    nPixYOffset = (nDataVal >= 0)? nDataVal : 0;
-    // Clip plot Y value
-    if (nPixYOffset > pBox->nWndHeight) { nPixYOffset = pBox->nWndHeight; }
+  // TODO: Consider supporting various color mapping modes
+  //colGraph = gslc_ColorBlend2(GSLC_COL_BLACK,GSLC_COL_WHITE,500,nDataVal*500/200);
 
-    // Calculate final Y coordinate
-    nPixY       = nPixYBase - nPixYOffset;
+  if (bRedrawAll) {
+    // Clear the background (inset from frame)
+    gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
+    gslc_DrawFillRect(pGui,rInner,colFill);
 
-    // Render the datapoints
-    if (pBox->eStyle == GSLCX_GRAPH_STYLE_DOT) {
-      gslc_DrawSetPixel(pGui,nPixX,nPixY,colGraph);
-    } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) {
-    } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) {
-      gslc_DrawLine(pGui,nPixX,nPixYBase,nPixX,nPixY,colGraph);
+    if (bPolyline) {
+      gslc_ElemXGraphDrawLine(pGui,pElem,pBox,0,nColMax-1,colGraph);
+    } else {
+      for (nPlotInd=0;nPlotInd<nColMax;nPlotInd++) {
+        gslc_ElemXGraphDrawCol(pGui,pElem,pBox,nPlotInd,colGraph);
+      }
+    }
+  } else if (bSweep) {
+    // Only replace the columns of the values added since the last
+    // redraw, the column at the cursor and, for the line style,
+    // the column after the cursor
+    if (pBox->nAddCnt > 0) {
+      uint16_t nColFirst = (nSweepCur + nColMax - nSweepNew) % nColMax;
+      for (uint16_t nInd=0;nInd<nSweepCnt;nInd++) {
+        nPlotInd = (nColFirst + nInd) % nColMax;
+        if (bPolyline) {
+          gslc_ElemXGraphDrawSpan(pGui,pElem,pBox,nPlotInd,0,pBox->nWndHeight,colFill);
+        } else {
+          gslc_ElemXGraphDrawColRepl(pGui,pElem,pBox,nPlotInd,colGraph,colFill);
+        }
+      }
+      if (bPolyline) {
+        // Redraw the segments that cross the cleared columns
+        int16_t nColLast = (int16_t)(nColFirst + nSweepCnt - 1);
+        if (nColLast < (int16_t)nColMax) {
+          gslc_ElemXGraphDrawLine(pGui,pElem,pBox,(int16_t)nColFirst-1,nColLast+1,colGraph);
+        } else {
+          gslc_ElemXGraphDrawLine(pGui,pElem,pBox,(int16_t)nColFirst-1,nColMax-1,colGraph);
+          gslc_ElemXGraphDrawLine(pGui,pElem,pBox,0,nColLast-nColMax+1,colGraph);
+        }
+      }
+    }
+  } else if (pBox->pEnvMin) {
+    // Only the newest envelope in the last column has changed
+    if (pBox->nAddCnt > 0) {
+      gslc_ElemXGraphDrawColRepl(pGui,pElem,pBox,nColMax-1,colGraph,colFill);
+    }
+  } else if (bPolyline) {
+    if ((pBox->nAddCnt > 0) || (pBox->nPlotIndStart != pBox->nDrawnStart)) {
+      // Every column has shifted, so erase the line shown at the
+      // last redraw by drawing it again in the fill color and then
+      // draw the new line
+      uint16_t nPlotIndStart = pBox->nPlotIndStart;
+      pBox->nPlotIndStart = pBox->nDrawnStart;
+      gslc_ElemXGraphDrawLine(pGui,pElem,pBox,0,nColMax-1,colFill);
+      pBox->nPlotIndStart = nPlotIndStart;
+      gslc_ElemXGraphDrawLine(pGui,pElem,pBox,0,nColMax-1,colGraph);
+    }
+  } else if ((pBox->nAddCnt > 0) || (pBox->nPlotIndStart != pBox->nDrawnStart)) {
+    // Every column has shifted, but neighbouring values are
+    // usually close so only the difference between the value
+    // previously shown in each column and the new one is drawn
+    uint16_t nBufIndOld,nBufInd;
+    for (nPlotInd=0;nPlotInd<nColMax;nPlotInd++) {
+      nBufIndOld = (pBox->nDrawnStart + nPlotInd) % pBox->nBufMax;
+      nBufInd    = (pBox->nPlotIndStart + nPlotInd) % pBox->nBufMax;
+      gslc_ElemXGraphDrawValDiff(pGui,pElem,pBox,nPlotInd,
+        gslc_ElemXGraphGetValOffset(pBox,pBox->pBuf[nBufIndOld]),
+        gslc_ElemXGraphGetValOffset(pBox,pBox->pBuf[nBufInd]),colGraph,colFill);
     }
-
   }
 
+  // Save the state shown on the display for the next incremental redraw
+  pBox->nDrawnStart = pBox->nPlotIndStart;
+  pBox->nAddCnt     = 0;
+  pBox->nEnvAddCnt  = 0;
+  pBox->bDrawnValid = true;
+
   // Clear the redraw flag
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
 
@@ -57,6 +57,12 @@ typedef enum {
   GSLCX_GRAPH_STYLE_FILL,       ///< Filled
 } gslc_teXGraphStyle;
 
+/// Graph update mode
+typedef enum {
+  GSLCX_GRAPH_MODE_SCROLL,      ///< Newest value at right edge, older values scroll left
+  GSLCX_GRAPH_MODE_SWEEP,       ///< Newest value at a cursor that sweeps left to right
+} gslc_teXGraphMode;
+
 // Extended element data structures
 // - These data structures are maintained in the gslc_tsElem
 //   structure via the pXData pointer
@@ -68,6 +74,7 @@ typedef struct {
   uint8_t                   nMargin;        ///< Margin for graph area within element rect
   gslc_tsColor              colGraph;       ///< Color of the graph
   gslc_teXGraphStyle        eStyle;         ///< Style of the graph
+  gslc_teXGraphMode         eMode;          ///< Update mode of the graph
 
   uint16_t                  nBufMax;        ///< Maximum number of points in buffer
   bool                      bScrollEn;      ///< Enable for scrollbar
@@ -83,6 +90,21 @@ typedef struct {
   uint16_t                  nBufCnt;        ///< Number of points in buffer
   uint16_t                  nPlotIndStart;  ///< First row of current window
 
+  // Incremental redraw state
+  bool                      bDrawnValid;    ///< Display reflects the state saved at the last redraw
+  uint16_t                  nDrawnStart;    ///< First row of the window at the last redraw
+  uint16_t                  nAddCnt;        ///< Number of points added since the last redraw
+  uint16_t                  nSweepX;        ///< Column of the sweep cursor (GSLCX_GRAPH_MODE_SWEEP)
+
+  // Decimation
+  int16_t*                  pEnvMin;        ///< Ptr to the minimum value of each column (NULL if disabled)
+  int16_t*                  pEnvMax;        ///< Ptr to the maximum value of each column (NULL if disabled)
+  uint16_t                  nEnvColMax;     ///< Number of columns with an envelope
+  uint16_t                  nEnvPerCol;     ///< Number of data points in each column
+  uint16_t                  nEnvFill;       ///< Number of data points in the newest column
+  uint16_t                  nEnvHead;       ///< Index of the newest column
+  uint16_t                  nEnvAddCnt;     ///< Number of columns started since the last redraw
+
 } gslc_tsXGraph;
 
 
@@ -120,6 +142,60 @@ gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
 void gslc_ElemXGraphSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
         gslc_teXGraphStyle eStyle,uint8_t nMargin);
 
+///
+/// Set the graph's update mode
+/// - In GSLCX_GRAPH_MODE_SCROLL the newest value is drawn at the right
+///   edge of the window. An incremental redraw only erases and redraws
+///   the part of each column that has changed. In GSLCX_GRAPH_STYLE_LINE
+///   the previous line is erased and the new line drawn instead.
+/// - In GSLCX_GRAPH_MODE_SWEEP the newest values are drawn at a cursor
+///   that advances one column per value and wraps at the right edge.
+///   An incremental redraw only touches the columns of the values added
+///   since the last redraw, so its cost doesn't depend on the window
+///   width. The scroll position is ignored in this mode.
+/// - In both modes any number of values may be added between redraws.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  eMode:       Update mode for the graph
+///
+/// \return none
+///
+void gslc_ElemXGraphSetMode(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
+        gslc_teXGraphMode eMode);
+
+///
+/// Enable decimation of the graph's data buffer
+/// - The buffer is divided into runs of consecutive data points that
+///   are each shown in a single column of the window, so the whole
+///   buffer is visible even when it holds many more points than
+///   the window is wide
+/// - The minimum and maximum of each run are kept up to date as
+///   values are added, so the cost of a redraw doesn't depend on
+///   the size of the buffer
+/// - Each column is drawn as a vertical span covering the run's
+///   range of values. In GSLCX_GRAPH_STYLE_LINE the span is extended
+///   to meet the previous column.
+/// - The scroll position is ignored while decimation is enabled
+/// - In GSLCX_GRAPH_MODE_SCROLL all of the columns shift whenever a new
+///   run is started, which clears and redraws the whole window. Only
+///   the redraws in between are incremental (the newest column).
+///   GSLCX_GRAPH_MODE_SWEEP avoids the full redraws.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pEnvBuf:     Ptr to envelope buffer (already allocated)
+///                          with size (2*nEnvMax) int16_t, or NULL
+///                          to disable decimation
+/// \param[in]  nEnvMax:     Maximum number of columns in the envelope
+///                          buffer. Only the columns that fit in the
+///                          window are used.
+///
+/// \return none
+///
+void gslc_ElemXGraphSetDecimate(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
+        int16_t* pEnvBuf,uint16_t nEnvMax);
+
 ///
 /// Set the graph's drawing range
 ///
@@ -103,6 +103,7 @@ gslc_tsElemRef* gslc_ElemXRingGaugeCreate(gslc_tsGui* pGui, int16_t nElemId, int
   pXData->nThickness = 10;
 
   pXData->nQuality = 72; // 360/72=5 degree segments
+  gslc_PolarCacheAdd(pGui, 64 * (360 / pXData->nQuality));
 
   pXData->bGradient = false;
   pXData->nSegGap = 0;
@@ -409,6 +410,9 @@ void gslc_ElemXRingGaugeSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, u
   nSegments = (nSegments == 0) ? 72 : nSegments; // Guard against div/0 with default
   pXRingGauge->nQuality = nSegments;
 
+  // Cache the segment boundary directions
+  gslc_PolarCacheAdd(pGui, 64 * (360 / nSegments));
+
   // Mark for full redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
@@ -0,0 +1,341 @@
+// =======================================================================
+// GUIslice library (image converter: BMP to RLE16)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2021 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+//
+// Convert an uncompressed 24-bit or 32-bit BMP file into a C array in
+// the run-length encoded RGB565 format (GSLC_IMGREF_FMT_RLE16). The
+// channel masks of 32-bit BI_BITFIELDS files are applied.
+//
+// Pixels that match the transparency color (default: magenta, as with
+// GSLC_BMP_TRANS_RGB) are stored as transparent runs that are skipped
+// when the image is drawn.
+//
+// Build:
+//   gcc -O2 -o bmp2rle bmp2rle.c
+//
+// Usage:
+//   bmp2rle [-n name] [-t RRGGBB|none] input.bmp output.c
+//
+// The generated array is then used in the same way as the BMP24 arrays:
+//   extern "C" const unsigned short exit_n24_rle[] PROGMEM;
+//   gslc_GetImageFromProg((const unsigned char*)exit_n24_rle,GSLC_IMGREF_FMT_RLE16)
+//
+// =======================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+
+// Run encoding (must match GUIslice.h)
+#define GSLC_RLE16_OP_COPY    0x0000
+#define GSLC_RLE16_OP_FILL    0x4000
+#define GSLC_RLE16_OP_SKIP    0x8000
+#define GSLC_RLE16_CNT_MASK   0x3FFF
+
+// Minimum number of repeated pixels that are stored as a FILL run
+#define RLE_FILL_MIN          3
+
+typedef struct {
+  uint16_t* pnWord;   // Encoded words
+  uint32_t  nLen;     // Number of encoded words
+  uint32_t  nSize;    // Allocated number of words
+} tsRleBuf;
+
+static void RleAdd(tsRleBuf* pBuf,uint16_t nWord)
+{
+  if (pBuf->nLen == pBuf->nSize) {
+    pBuf->nSize = (pBuf->nSize == 0)? 1024 : pBuf->nSize * 2;
+    pBuf->pnWord = (uint16_t*)realloc(pBuf->pnWord,pBuf->nSize * sizeof(uint16_t));
+    if (pBuf->pnWord == NULL) {
+      fprintf(stderr,"ERROR: out of memory\n");
+      exit(1);
+    }
+  }
+  pBuf->pnWord[pBuf->nLen++] = nWord;
+}
+
+static uint32_t ReadLE(const uint8_t* pData,int nBytes)
+{
+  uint32_t nVal = 0;
+  for (int nInd = nBytes-1; nInd >= 0; nInd--) {
+    nVal = (nVal << 8) | pData[nInd];
+  }
+  return nVal;
+}
+
+// Extract a color channel selected by a bit mask and scale it to 8 bits
+static uint8_t ReadChannel(uint32_t nPixel,uint32_t nMask)
+{
+  uint32_t nMax = nMask;
+  while ((nMax & 1) == 0) {
+    nMax >>= 1;
+  }
+  uint32_t nVal = (nPixel & nMask) / (nMask / nMax);
+  return (uint8_t)(((uint64_t)nVal * 255 + nMax / 2) / nMax);
+}
+
+// Load a BMP file into a top-down RGB888 buffer
+static uint8_t* LoadBmp(const char* pFname,int* pnW,int* pnH)
+{
+  FILE* pFile = fopen(pFname,"rb");
+  if (pFile == NULL) {
+    fprintf(stderr,"ERROR: can't open [%s]\n",pFname);
+    return NULL;
+  }
+  uint8_t anHdr[54];
+  if ((fread(anHdr,1,sizeof(anHdr),pFile) != sizeof(anHdr)) || (anHdr[0] != 'B') || (anHdr[1] != 'M')) {
+    fprintf(stderr,"ERROR: [%s] is not a BMP file\n",pFname);
+    fclose(pFile);
+    return NULL;
+  }
+  uint32_t nOffset = ReadLE(&anHdr[10],4);
+  int32_t  nW      = (int32_t)ReadLE(&anHdr[18],4);
+  int32_t  nH      = (int32_t)ReadLE(&anHdr[22],4);
+  uint16_t nDepth  = (uint16_t)ReadLE(&anHdr[28],2);
+  uint32_t nComp   = ReadLE(&anHdr[30],4);
+  bool     bFlip   = true;  // BMP is normally stored bottom-to-top
+  if (nH < 0) {
+    nH    = -nH;
+    bFlip = false;
+  }
+  if (((nDepth != 24) && (nDepth != 32)) || ((nComp != 0) && !((nComp == 3) && (nDepth == 32)))) {
+    fprintf(stderr,"ERROR: [%s] only uncompressed 24-bit or 32-bit BMP is supported\n",pFname);
+    fclose(pFile);
+    return NULL;
+  }
+  // Channel masks default to B,G,R(,A) byte order. 32-bit BMP with
+  // BI_BITFIELDS stores the masks after the 40-byte info header.
+  uint32_t anMask[3] = { 0x00FF0000, 0x0000FF00, 0x000000FF };
+  if (nComp == 3) {
+    uint8_t anMaskHdr[12];
+    if ((fseek(pFile,54,SEEK_SET) != 0) || (fread(anMaskHdr,1,sizeof(anMaskHdr),pFile) != sizeof(anMaskHdr))) {
+      fprintf(stderr,"ERROR: [%s] is truncated\n",pFname);
+      fclose(pFile);
+      return NULL;
+    }
+    for (int nInd = 0; nInd < 3; nInd++) {
+      anMask[nInd] = ReadLE(&anMaskHdr[nInd*4],4);
+      if (anMask[nInd] == 0) {
+        fprintf(stderr,"ERROR: [%s] has an empty color mask\n",pFname);
+        fclose(pFile);
+        return NULL;
+      }
+    }
+  }
+  if ((nW <= 0) || (nH <= 0) || (nW > GSLC_RLE16_CNT_MASK) || (nH > 0x7FFF)) {
+    fprintf(stderr,"ERROR: [%s] unsupported image size %dx%d\n",pFname,nW,nH);
+    fclose(pFile);
+    return NULL;
+  }
+
+  uint32_t nBytesPP = nDepth / 8;
+  uint32_t nRowSize = (nW * nBytesPP + 3) & ~3u;
+  uint8_t* pRow     = (uint8_t*)malloc(nRowSize);
+  uint8_t* pPixels  = (uint8_t*)malloc((size_t)nW * nH * 3);
+  if ((pRow == NULL) || (pPixels == NULL)) {
+    fprintf(stderr,"ERROR: out of memory\n");
+    exit(1);
+  }
+  for (int32_t nRow = 0; nRow < nH; nRow++) {
+    int32_t nDstRow = (bFlip)? (nH - 1 - nRow) : nRow;
+    if ((fseek(pFile,nOffset + nRow * nRowSize,SEEK_SET) != 0) || (fread(pRow,1,nRowSize,pFile) != nRowSize)) {
+      fprintf(stderr,"ERROR: [%s] is truncated\n",pFname);
+      free(pRow);
+      free(pPixels);
+      fclose(pFile);
+      return NULL;
+    }
+    uint8_t* pDst = pPixels + (size_t)nDstRow * nW * 3;
+    for (int32_t nCol = 0; nCol < nW; nCol++) {
+      uint32_t nPixel = ReadLE(&pRow[nCol*nBytesPP],nBytesPP);
+      pDst[nCol*3+0] = ReadChannel(nPixel,anMask[0]);
+      pDst[nCol*3+1] = ReadChannel(nPixel,anMask[1]);
+      pDst[nCol*3+2] = ReadChannel(nPixel,anMask[2]);
+    }
+  }
+  free(pRow);
+  fclose(pFile);
+  *pnW = nW;
+  *pnH = nH;
+  return pPixels;
+}
+
+// Encode one row of pixels
+// - anPix565[]: RGB565 pixel values
+// - abTrans[]:  true if the pixel is transparent
+static void EncodeRow(tsRleBuf* pBuf,const uint16_t* anPix565,const bool* abTrans,int nW)
+{
+  int nX = 0;
+  while (nX < nW) {
+    int nRun = 1;
+    if (abTrans[nX]) {
+      while ((nX + nRun < nW) && (abTrans[nX + nRun]) && (nRun < GSLC_RLE16_CNT_MASK)) { nRun++; }
+      RleAdd(pBuf,GSLC_RLE16_OP_SKIP | nRun);
+      nX += nRun;
+      continue;
+    }
+    while ((nX + nRun < nW) && (!abTrans[nX + nRun]) && (anPix565[nX + nRun] == anPix565[nX]) &&
+      (nRun < GSLC_RLE16_CNT_MASK)) { nRun++; }
+    if (nRun >= RLE_FILL_MIN) {
+      RleAdd(pBuf,GSLC_RLE16_OP_FILL | nRun);
+      RleAdd(pBuf,anPix565[nX]);
+      nX += nRun;
+      continue;
+    }
+    // Collect individual pixels until a transparent or solid run starts
+    int nEnd = nX;
+    while ((nEnd < nW) && (!abTrans[nEnd]) && (nEnd - nX < GSLC_RLE16_CNT_MASK)) {
+      int nSame = 1;
+      while ((nEnd + nSame < nW) && (nSame < RLE_FILL_MIN) && (!abTrans[nEnd + nSame]) &&
+        (anPix565[nEnd + nSame] == anPix565[nEnd])) { nSame++; }
+      if (nSame >= RLE_FILL_MIN) { break; }
+      nEnd++;
+    }
+    RleAdd(pBuf,GSLC_RLE16_OP_COPY | (nEnd - nX));
+    for (; nX < nEnd; nX++) {
+      RleAdd(pBuf,anPix565[nX]);
+    }
+  }
+}
+
+static void Usage(void)
+{
+  fprintf(stderr,"Usage: bmp2rle [-n name] [-t RRGGBB|none] input.bmp output.c\n");
+  fprintf(stderr,"  -n name    Name of the generated array (default: from output file)\n");
+  fprintf(stderr,"  -t RRGGBB  Transparency color (default: FF00FF), or none\n");
+  exit(1);
+}
+
+int main(int argc,char* argv[])
+{
+  const char* pName   = NULL;
+  bool        bTrans  = true;
+  uint32_t    nTrans  = 0xFF00FF;
+  int         nArg    = 1;
+
+  for (; (nArg < argc) && (argv[nArg][0] == '-'); nArg++) {
+    if ((strcmp(argv[nArg],"-n") == 0) && (nArg + 1 < argc)) {
+      pName = argv[++nArg];
+    } else if ((strcmp(argv[nArg],"-t") == 0) && (nArg + 1 < argc)) {
+      nArg++;
+      if (strcmp(argv[nArg],"none") == 0) {
+        bTrans = false;
+      } else {
+        nTrans = (uint32_t)strtoul(argv[nArg],NULL,16);
+      }
+    } else {
+      Usage();
+    }
+  }
+  if (argc - nArg != 2) {
+    Usage();
+  }
+  const char* pFnameIn  = argv[nArg];
+  const char* pFnameOut = argv[nArg+1];
+
+  // Default the array name to the output file name without path and extension
+  char acName[64];
+  if (pName == NULL) {
+    const char* pBase = strrchr(pFnameOut,'/');
+    pBase = (pBase)? pBase + 1 : pFnameOut;
+    size_t nLen = 0;
+    for (; (pBase[nLen] != '\0') && (pBase[nLen] != '.') && (nLen < sizeof(acName)-1); nLen++) {
+      acName[nLen] = (isalnum((unsigned char)pBase[nLen]))? pBase[nLen] : '_';
+    }
+    acName[nLen] = '\0';
+    pName = acName;
+  }
+
+  int      nW, nH;
+  uint8_t* pPixels = LoadBmp(pFnameIn,&nW,&nH);
+  if (pPixels == NULL) {
+    return 1;
+  }
+
+  tsRleBuf  sBuf     = { NULL, 0, 0 };
+  uint16_t* anPix565 = (uint16_t*)malloc(nW * sizeof(uint16_t));
+  bool*     abTrans  = (bool*)malloc(nW * sizeof(bool));
+  RleAdd(&sBuf,(uint16_t)nH);
+  RleAdd(&sBuf,(uint16_t)nW);
+  for (int nRow = 0; nRow < nH; nRow++) {
+    const uint8_t* pSrc = pPixels + (size_t)nRow * nW * 3;
+    for (int nCol = 0; nCol < nW; nCol++) {
+      uint8_t nR = pSrc[nCol*3+0];
+      uint8_t nG = pSrc[nCol*3+1];
+      uint8_t nB = pSrc[nCol*3+2];
+      anPix565[nCol] = ((nR & 0xF8) << 8) | ((nG & 0xFC) << 3) | (nB >> 3);
+      abTrans[nCol]  = bTrans && ((((uint32_t)nR << 16) | ((uint32_t)nG << 8) | nB) == nTrans);
+    }
+    EncodeRow(&sBuf,anPix565,abTrans,nW);
+  }
+
+  FILE* pFile = fopen(pFnameOut,"w");
+  if (pFile == NULL) {
+    fprintf(stderr,"ERROR: can't create [%s]\n",pFnameOut);
+    return 1;
+  }
+  const char* pBaseIn = strrchr(pFnameIn,'/');
+  pBaseIn = (pBaseIn)? pBaseIn + 1 : pFnameIn;
+  fprintf(pFile,"// Generated by   : bmp2rle\n");
+  fprintf(pFile,"// Generated from : %s\n",pBaseIn);
+  fprintf(pFile,"// Image Size     : %dx%d pixels\n",nW,nH);
+  fprintf(pFile,"// Memory usage   : %u bytes (uncompressed: %u bytes)\n",
+    (unsigned)(sBuf.nLen * 2),(unsigned)((nW * nH + 2) * 2));
+  fprintf(pFile,"// Image format   : GSLC_IMGREF_FMT_RLE16\n\n");
+  fprintf(pFile,"#include \"GUIslice.h\"\n");
+  fprintf(pFile,"#include \"GUIslice_config.h\"\n");
+  fprintf(pFile,"#if (GSLC_USE_PROGMEM)\n");
+  fprintf(pFile,"  #if defined(__AVR__)\n");
+  fprintf(pFile,"    #include <avr/pgmspace.h>\n");
+  fprintf(pFile,"  #else\n");
+  fprintf(pFile,"    #include <pgmspace.h>\n");
+  fprintf(pFile,"  #endif\n");
+  fprintf(pFile,"#endif\n\n");
+  fprintf(pFile,"const unsigned short %s[%u] GSLC_PMEM ={\n",pName,(unsigned)sBuf.nLen);
+  fprintf(pFile,"%u, // Height of image\n",sBuf.pnWord[0]);
+  fprintf(pFile,"%u, // Width of image\n",sBuf.pnWord[1]);
+  for (uint32_t nInd = 2; nInd < sBuf.nLen; nInd++) {
+    fprintf(pFile,"0x%04X,%s",sBuf.pnWord[nInd],(((nInd - 2) % 16) == 15)? "\n" : " ");
+  }
+  fprintf(pFile,"\n};\n");
+  fclose(pFile);
+
+  printf("%s: %dx%d, %u bytes (uncompressed: %u bytes)\n",pName,nW,nH,
+    (unsigned)(sBuf.nLen * 2),(unsigned)((nW * nH + 2) * 2));
+
+  free(anPix565);
+  free(abTrans);
+  free(sBuf.pnWord);
+  free(pPixels);
+  return 0;
+}